@@ -0,0 +1,531 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+/* Standard benchmark suite of fplll, run with `make bench`.
+
+   Every benchmark generates its lattice with RandGen seeded with the value of -seed (as
+   `latticegen -randseed`), so that two runs with the same seed work on the same inputs. The
+   results (wall clock and cpu time, node rates, peak resident set size) are written as JSON. */
+
+#include "io/json.hpp"
+#include "sieve/sieve_gauss.h"
+#include <chrono>
+#include <fplll.h>
+
+using json = nlohmann::json;
+
+#ifndef BENCHDATADIR
+#define BENCHDATADIR ".."
+#endif
+
+using namespace std;
+using namespace fplll;
+
+struct BenchOptions
+{
+  BenchOptions()
+      : seed(1), quick(false), filter(""), output(NULL),
+        strategies(BENCHDATADIR "/strategies/default.json"), threads(1)
+  {
+  }
+  unsigned long seed;
+  bool quick;
+  string filter;
+  const char *output;
+  string strategies;
+  int threads;
+};
+
+/**
+   @brief Peak resident set size in KiB since the last call to reset_peak_rss().
+
+   On Linux, the peak is reset through /proc/self/clear_refs, so that every benchmark reports its own
+   peak. Elsewhere, this is the peak of the whole process.
+*/
+
+static void reset_peak_rss()
+{
+#ifdef __linux__
+  ofstream clear_refs("/proc/self/clear_refs");
+  if (clear_refs)
+    clear_refs << "5" << endl;
+#endif
+}
+
+static long peak_rss()
+{
+#ifdef __linux__
+  ifstream status("/proc/self/status");
+  string line;
+  while (getline(status, line))
+  {
+    if (line.compare(0, 6, "VmHWM:") == 0)
+      return atol(line.c_str() + 6);
+  }
+#endif
+#ifdef FPLLL_WITH_GETRUSAGE
+  struct rusage rus;
+  getrusage(RUSAGE_SELF, &rus);
+  return rus.ru_maxrss;
+#else
+  return 0;
+#endif
+}
+
+/**
+   @brief Measures the part of a benchmark between start() and stop().
+*/
+
+class Stopwatch
+{
+public:
+  Stopwatch() : wall(0.0), cpu(0.0) {}
+
+  void start()
+  {
+    reset_peak_rss();
+    cpu_start  = cputime();
+    wall_start = chrono::steady_clock::now();
+  }
+
+  void stop()
+  {
+    wall += chrono::duration<double>(chrono::steady_clock::now() - wall_start).count();
+    cpu += (cputime() - cpu_start) * 0.001;
+  }
+
+  /** wall clock time in seconds **/
+  double wall;
+  /** cpu time in seconds **/
+  double cpu;
+
+private:
+  chrono::steady_clock::time_point wall_start;
+  int cpu_start;
+};
+
+class BenchRunner
+{
+public:
+  BenchRunner(const BenchOptions &opt) : opt(opt), results(json::array()) {}
+
+  /**
+     @brief Run benchmark `name` if it matches the filter.
+
+     `bench` sets up its input, calls `start()` and `stop()` on the stopwatch around the measured
+     part and may add its own fields (e.g. "nodes") to the result.
+  */
+  template <class F> void run(const string &name, F bench)
+  {
+    if (!opt.filter.empty() && name.find(opt.filter) == string::npos)
+      return;
+    cerr << name << "... " << flush;
+
+    RandGen::init_with_seed(opt.seed);
+    json result;
+    result["name"] = name;
+    Stopwatch sw;
+    bench(result, sw);
+    result["time"]        = sw.wall;
+    result["cputime"]     = sw.cpu;
+    result["peak_rss_kb"] = peak_rss();
+    if (result.count("nodes"))
+      result["node_rate"] = sw.wall > 0 ? result["nodes"].get<double>() / sw.wall : 0.0;
+
+    cerr << sw.wall << "s" << endl;
+    results.push_back(result);
+  }
+
+  const BenchOptions &opt;
+  json results;
+};
+
+/**
+   @brief Generate a lattice as latticegen does.
+
+   @param type             "r" (knapsack-like, d x (d+1)), "q" (q-ary, k = d/2) or "u" (uniform)
+*/
+
+static void gen_lattice(ZZ_mat<mpz_t> &b, json &result, char type, int d, int bits)
+{
+  switch (type)
+  {
+  case 'r':
+    b.resize(d, d + 1);
+    b.gen_intrel(bits);
+    break;
+  case 'q':
+    b.resize(d, d);
+    b.gen_qary_prime(d / 2, bits);
+    break;
+  case 'u':
+    b.resize(d, d);
+    b.gen_uniform(bits);
+    break;
+  default:
+    FPLLL_ABORT("unknown lattice type " << type);
+  }
+  result["lattice"]   = string(1, type);
+  result["dimension"] = d;
+  result["bits"]      = bits;
+}
+
+/* LLL */
+
+template <class ZT>
+static void bench_lll_zt(BenchRunner &runner, const char *zt_name, char type, int d, int bits)
+{
+  const FloatType float_types[] = {FT_DOUBLE,
+#ifdef FPLLL_WITH_LONG_DOUBLE
+                                   FT_LONG_DOUBLE,
+#endif
+#ifdef FPLLL_WITH_DPE
+                                   FT_DPE,
+#endif
+#ifdef FPLLL_WITH_QD
+                                   FT_DD,
+                                   FT_QD,
+#endif
+                                   FT_MPFR};
+
+  for (FloatType ft : float_types)
+  {
+    // fast is only defined for hardware-like types
+    LLLMethod method = (ft == FT_DPE || ft == FT_MPFR) ? LM_HEURISTIC : LM_FAST;
+    string ft_name = FLOAT_TYPE_STR[ft];
+    replace(ft_name.begin(), ft_name.end(), ' ', '_');
+    string name = string("lll/") + zt_name + "/" + ft_name + "/" + LLL_METHOD_STR[method];
+    runner.run(name, [&](json &result, Stopwatch &sw) {
+      ZZ_mat<mpz_t> tmp;
+      gen_lattice(tmp, result, type, d, bits);
+      ZZ_mat<ZT> b;
+      FPLLL_CHECK(convert(b, tmp), "lattice entries too large for " << zt_name);
+      sw.start();
+      int status = lll_reduction(b, LLL_DEF_DELTA, LLL_DEF_ETA, method, ft);
+      sw.stop();
+      result["status"] = get_red_status_str(status);
+    });
+  }
+}
+
+static void bench_lll(BenchRunner &runner)
+{
+  bool quick = runner.opt.quick;
+
+  // small entries so that every integer type can be used
+  int d = quick ? 60 : 120, bits = 20;
+  bench_lll_zt<mpz_t>(runner, "mpz", 'q', d, bits);
+#ifdef FPLLL_WITH_ZLONG
+  bench_lll_zt<long>(runner, "long", 'q', d, bits);
+#endif
+#ifdef FPLLL_WITH_ZDOUBLE
+  bench_lll_zt<double>(runner, "double", 'q', d, bits);
+#endif
+
+  // large entries, where the wrapper has to increase the precision
+  d    = quick ? 40 : 80;
+  bits = quick ? 400 : 800;
+  runner.run("lll/wrapper", [&](json &result, Stopwatch &sw) {
+    ZZ_mat<mpz_t> b;
+    gen_lattice(b, result, 'r', d, bits);
+    sw.start();
+    int status = lll_reduction(b);
+    sw.stop();
+    result["status"] = get_red_status_str(status);
+  });
+  runner.run("lll/wrapper/predict", [&](json &result, Stopwatch &sw) {
+    ZZ_mat<mpz_t> b;
+    gen_lattice(b, result, 'r', d, bits);
+    sw.start();
+    int status = lll_reduction(b, LLL_DEF_DELTA, LLL_DEF_ETA, LM_WRAPPER, FT_DEFAULT, 0,
+                               LLL_PREDICT_PREC);
+    sw.stop();
+    result["status"] = get_red_status_str(status);
+  });
+  runner.run("lll/mpz/mpfr/proved", [&](json &result, Stopwatch &sw) {
+    ZZ_mat<mpz_t> b;
+    gen_lattice(b, result, 'r', d, bits);
+    sw.start();
+    int status = lll_reduction(b, LLL_DEF_DELTA, LLL_DEF_ETA, LM_PROVED, FT_MPFR);
+    sw.stop();
+    result["status"] = get_red_status_str(status);
+  });
+  runner.run("hlll/wrapper", [&](json &result, Stopwatch &sw) {
+    ZZ_mat<mpz_t> b;
+    gen_lattice(b, result, 'r', d, bits);
+    sw.start();
+    int status = hlll_reduction(b);
+    sw.stop();
+    result["status"] = get_red_status_str(status);
+  });
+}
+
+/* BKZ */
+
+// BKZ in double precision with the given method, on an LLL-reduced basis
+static void bench_bkz_run(ZZ_mat<mpz_t> &b, const BKZParam &param, BKZMethod method, json &result,
+                          Stopwatch &sw)
+{
+  ZZ_mat<mpz_t> u, u_inv;
+  int status;
+  long nodes;
+  try
+  {
+    if (method == BKZ_METHOD_HOUSEHOLDER)
+    {
+      MatHouseholder<Z_NR<mpz_t>, FP_NR<double>> m(b, u, u_inv, HOUSEHOLDER_ROW_EXPO);
+      HLLLReduction<Z_NR<mpz_t>, FP_NR<double>> hlll_obj(m, LLL_DEF_DELTA, LLL_DEF_ETA,
+                                                         HLLL_DEF_THETA, HLLL_DEF_C, LLL_DEFAULT);
+      HBKZReduction<Z_NR<mpz_t>, FP_NR<double>> bkz_obj(m, hlll_obj, param);
+      sw.start();
+      bkz_obj.bkz();
+      sw.stop();
+      status = bkz_obj.status;
+      nodes  = bkz_obj.nodes;
+    }
+    else
+    {
+      MatGSO<Z_NR<mpz_t>, FP_NR<double>> m(b, u, u_inv, GSO_ROW_EXPO);
+      LLLReduction<Z_NR<mpz_t>, FP_NR<double>> lll_obj(m, LLL_DEF_DELTA, LLL_DEF_ETA, LLL_DEFAULT);
+      BKZReduction<Z_NR<mpz_t>, FP_NR<double>> bkz_obj(m, lll_obj, param);
+      sw.start();
+      bkz_obj.bkz();
+      sw.stop();
+      status = bkz_obj.status;
+      nodes  = bkz_obj.nodes;
+    }
+  }
+  catch (std::runtime_error &e)
+  {
+    // loss of precision in the LLL calls of BKZ
+    sw.stop();
+    result["status"] = e.what();
+    return;
+  }
+
+  // slope of the output, with the same (accurate) GSO for both methods
+  int old_prec = FP_NR<mpfr_t>::set_prec(120);
+  MatGSO<Z_NR<mpz_t>, FP_NR<mpfr_t>> m(b, u, u_inv, GSO_DEFAULT);
+  m.update_gso();
+  result["method"]  = BKZ_METHOD_STR[method];
+  result["threads"] = get_threads();
+  result["status"]  = get_red_status_str(status);
+  result["nodes"]   = static_cast<double>(nodes);
+  result["slope"]   = m.get_current_slope(0, b.get_rows());
+  FP_NR<mpfr_t>::set_prec(old_prec);
+}
+
+static void bench_bkz(BenchRunner &runner)
+{
+  vector<Strategy> strategies = load_strategies_json(runner.opt.strategies);
+  const int block_sizes[]     = {20, 40, 60};
+  const int dims[]            = {160, 120, 120};
+  const int quick_dims[]      = {120, 90, 80};
+  const int tours             = 2;
+
+  // sequential tours, parallel tours (BKZ_PARALLEL) and tours on MatHouseholder
+  // (BKZ_METHOD_HOUSEHOLDER) on the same lattices, to compare the wall clock time and the slope
+  // reached after the same number of tours
+  const char *variants[] = {"", "/parallel", "/householder"};
+  for (int i = 0; i < 9; i++)
+  {
+    int block_size = block_sizes[i % 3];
+    int d          = runner.opt.quick ? quick_dims[i % 3] : dims[i % 3];
+    int variant    = i / 3;
+    string name    = "bkz/" + to_string(block_size) + variants[variant];
+    runner.run(name, [&](json &result, Stopwatch &sw) {
+      ZZ_mat<mpz_t> b;
+      gen_lattice(b, result, 'q', d, 30);
+      lll_reduction(b);
+
+      BKZParam param(block_size, strategies);
+      param.flags     = BKZ_DEFAULT | BKZ_MAX_LOOPS | BKZ_GH_BND | (variant == 1 ? BKZ_PARALLEL : 0);
+      param.max_loops = tours;
+      bench_bkz_run(b, param, variant == 2 ? BKZ_METHOD_HOUSEHOLDER : BKZ_METHOD_GSO, result, sw);
+      result["block_size"] = block_size;
+      result["tours"]      = tours;
+    });
+  }
+
+  // one tour in large dimension, where the precision of double is the limit of MatGSO
+  for (int variant = 0; variant < 2; variant++)
+  {
+    int d       = runner.opt.quick ? 180 : 260;
+    string name = string("bkz/20/large") + (variant ? "/householder" : "");
+    runner.run(name, [&](json &result, Stopwatch &sw) {
+      ZZ_mat<mpz_t> b;
+      gen_lattice(b, result, 'q', d, 30);
+      lll_reduction(b);
+
+      BKZParam param(20, strategies);
+      param.flags     = BKZ_DEFAULT | BKZ_MAX_LOOPS | BKZ_GH_BND;
+      param.max_loops = 1;
+      bench_bkz_run(b, param, variant ? BKZ_METHOD_HOUSEHOLDER : BKZ_METHOD_GSO, result, sw);
+      result["block_size"] = 20;
+      result["tours"]      = 1;
+    });
+  }
+}
+
+/* Enumeration and pruning, on BKZ-20 reduced bases */
+
+static void bkz20_basis(ZZ_mat<mpz_t> &b, json &result, int d)
+{
+  gen_lattice(b, result, 'q', d, 30);
+  lll_reduction(b);
+  vector<Strategy> strategies;
+  BKZParam param(20, strategies);
+  param.flags = BKZ_DEFAULT | BKZ_AUTO_ABORT;
+  bkz_reduction(&b, NULL, param, FT_DEFAULT, 0);
+}
+
+static void bench_enum(BenchRunner &runner)
+{
+  int d = runner.opt.quick ? 46 : 52;
+  std::function<extenum_fc_enumerate> enumlib = get_external_enumerator();
+
+  for (int external = 0; external < 2; external++)
+  {
+    if (external && enumlib == nullptr)
+      continue;
+    runner.run(external ? "enum/enumlib" : "enum/internal", [&](json &result, Stopwatch &sw) {
+      ZZ_mat<mpz_t> b, u, u_inv;
+      bkz20_basis(b, result, d);
+
+      MatGSO<Z_NR<mpz_t>, FP_NR<double>> m(b, u, u_inv, GSO_DEFAULT);
+      m.update_gso();
+      FastEvaluator<FP_NR<double>> evaluator;
+      Enumeration<Z_NR<mpz_t>, FP_NR<double>> enum_obj(m, evaluator);
+      FP_NR<double> max_dist;
+      long max_dist_expo;
+      max_dist = m.get_r_exp(0, 0, max_dist_expo);
+
+      set_external_enumerator(external ? enumlib : nullptr);
+      sw.start();
+      enum_obj.enumerate(0, d, max_dist, max_dist_expo);
+      sw.stop();
+      set_external_enumerator(enumlib);
+
+      result["threads"] = external ? get_threads() : 1;
+      result["nodes"]   = static_cast<double>(enum_obj.get_nodes());
+    });
+  }
+}
+
+static void bench_pruner(BenchRunner &runner)
+{
+  int d = runner.opt.quick ? 80 : 120;
+  runner.run("pruner", [&](json &result, Stopwatch &sw) {
+    ZZ_mat<mpz_t> b, u, u_inv;
+    bkz20_basis(b, result, d);
+
+    MatGSO<Z_NR<mpz_t>, FP_NR<double>> m(b, u, u_inv, GSO_DEFAULT);
+    m.update_gso();
+    vector<double> r;
+    FP_NR<double> f;
+    for (int i = 0; i < d; i++)
+    {
+      m.get_r(f, i, i);
+      r.push_back(f.get_d());
+    }
+
+    PruningParams pruning;
+    sw.start();
+    prune<FP_NR<double>>(pruning, r[0], pow(2.0, d / 4.0), r, 0.51);
+    sw.stop();
+    result["expectation"] = pruning.expectation;
+  });
+}
+
+static void bench_sieve(BenchRunner &runner)
+{
+  int d = runner.opt.quick ? 40 : 50;
+  runner.run("sieve/gauss", [&](json &result, Stopwatch &sw) {
+    ZZ_mat<mpz_t> b;
+    gen_lattice(b, result, 'q', d, 30);
+    lll_reduction(b);
+
+    GaussSieve<mpz_t, FP_NR<double>> gsieve(b, 2, false, runner.opt.seed);
+    Z_NR<mpz_t> goal_norm;
+    goal_norm = 0;
+    sw.start();
+    gsieve.sieve(goal_norm);
+    sw.stop();
+  });
+}
+
+static void usage()
+{
+  cerr << "Usage: fplll_bench [options]\n"
+       << "  -seed <n>           Seed for the generation of the lattices [default=1]\n"
+       << "  -quick              Smaller dimensions, for a run of a few minutes\n"
+       << "  -filter <string>    Only run the benchmarks whose name contains <string>\n"
+       << "  -strategies <file>  BKZ strategies [default=strategies/default.json]\n"
+       << "  -threads <n>        Threads of enumlib and parallel BKZ, -1 = all cores [default=1]\n"
+       << "  -o <file>           Write the JSON results to <file> instead of stdout\n";
+}
+
+int main(int argc, char **argv)
+{
+  BenchOptions opt;
+  for (int i = 1; i < argc; i++)
+  {
+    bool has_arg = i + 1 < argc;
+    if (strcmp(argv[i], "-seed") == 0 && has_arg)
+      opt.seed = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-quick") == 0)
+      opt.quick = true;
+    else if (strcmp(argv[i], "-filter") == 0 && has_arg)
+      opt.filter = argv[++i];
+    else if (strcmp(argv[i], "-strategies") == 0 && has_arg)
+      opt.strategies = argv[++i];
+    else if (strcmp(argv[i], "-threads") == 0 && has_arg)
+      opt.threads = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-o") == 0 && has_arg)
+      opt.output = argv[++i];
+    else
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  set_threads(opt.threads);
+  BenchRunner runner(opt);
+  bench_lll(runner);
+  bench_bkz(runner);
+  bench_enum(runner);
+  bench_pruner(runner);
+  bench_sieve(runner);
+
+  json report;
+  report["fplll_version"] = to_string(FPLLL_MAJOR_VERSION) + "." + to_string(FPLLL_MINOR_VERSION) +
+                            "." + to_string(FPLLL_MICRO_VERSION);
+  report["seed"]          = opt.seed;
+  report["quick"]         = opt.quick;
+  report["threads"]       = get_threads();
+  report["benchmarks"]    = runner.results;
+
+  if (opt.output)
+  {
+    ofstream out(opt.output);
+    out << report.dump(2) << endl;
+  }
+  else
+  {
+    cout << report.dump(2) << endl;
+  }
+  return 0;
+}
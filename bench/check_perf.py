@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Performance regression harness for fplll, run with `make check-perf`.
+
+Runs the benchmark program (fplll_bench) several times and compares the wall clock time of every
+benchmark with a baseline stored for the current machine. The machine is identified by a
+fingerprint of its CPU model, number of CPUs, memory and operating system, so baselines recorded
+on different hardware are never mixed.
+
+A benchmark is reported as a regression when the lower end of the confidence interval of its
+slowdown (Welch's t-interval on the difference of the means) exceeds the tolerance. If there is no
+baseline for the machine yet, or with --update, the measured times are stored as the new baseline.
+The exit code is 1 if there is at least one regression and 0 otherwise.
+"""
+
+from optparse import OptionParser
+import hashlib
+import json
+import math
+import os
+import platform
+import subprocess
+import sys
+import tempfile
+
+
+def machine_fingerprint():
+    cpu = platform.processor()
+    mem = 0
+    try:
+        with open("/proc/cpuinfo") as f:
+            for line in f:
+                if line.startswith("model name"):
+                    cpu = line.split(":", 1)[1].strip()
+                    break
+        with open("/proc/meminfo") as f:
+            for line in f:
+                if line.startswith("MemTotal:"):
+                    mem = int(line.split()[1]) // (1024 * 1024)
+                    break
+    except IOError:
+        pass
+    info = {
+        "cpu": cpu,
+        "cpus": os.cpu_count(),
+        "machine": platform.machine(),
+        "memory_gb": mem,
+        "system": platform.system(),
+    }
+    key = hashlib.sha1(json.dumps(info, sort_keys=True).encode()).hexdigest()[:12]
+    return key, info
+
+
+# Student's t distribution, from the regularized incomplete beta function (Numerical Recipes)
+
+def betacf(a, b, x):
+    qab, qap, qam = a + b, a + 1.0, a - 1.0
+    c, d = 1.0, 1.0 - qab * x / qap
+    d = 1.0 / (d if abs(d) > 1e-30 else 1e-30)
+    h = d
+    for m in range(1, 200):
+        m2 = 2 * m
+        aa = m * (b - m) * x / ((qam + m2) * (a + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > 1e-30 else 1e-30)
+        c = 1.0 + aa / c
+        c = c if abs(c) > 1e-30 else 1e-30
+        h *= d * c
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > 1e-30 else 1e-30)
+        c = 1.0 + aa / c
+        c = c if abs(c) > 1e-30 else 1e-30
+        delta = d * c
+        h *= delta
+        if abs(delta - 1.0) < 1e-12:
+            break
+    return h
+
+
+def betai(a, b, x):
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    lbeta = math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b)
+    front = math.exp(lbeta + a * math.log(x) + b * math.log(1.0 - x))
+    if x < (a + 1.0) / (a + b + 2.0):
+        return front * betacf(a, b, x) / a
+    return 1.0 - front * betacf(b, a, 1.0 - x) / b
+
+
+def t_quantile(p, df):
+    """Quantile of Student's t distribution with df degrees of freedom, for p in (0.5, 1)."""
+    lo, hi = 0.0, 1e3
+    for _ in range(200):
+        t = (lo + hi) / 2
+        cdf = 1.0 - 0.5 * betai(df / 2.0, 0.5, df / (df + t * t))
+        if cdf < p:
+            lo = t
+        else:
+            hi = t
+    return (lo + hi) / 2
+
+
+def summary(samples):
+    n = len(samples)
+    mean = sum(samples) / n
+    var = sum((x - mean) ** 2 for x in samples) / (n - 1) if n > 1 else 0.0
+    return {"mean": mean, "stdev": math.sqrt(var), "n": n, "samples": samples}
+
+
+def compare(base, new, confidence):
+    """Confidence interval of new mean - base mean (Welch)."""
+    va = base["stdev"] ** 2 / base["n"]
+    vb = new["stdev"] ** 2 / new["n"]
+    diff = new["mean"] - base["mean"]
+    se = math.sqrt(va + vb)
+    if se == 0.0:
+        return diff, diff
+    num = (va + vb) ** 2
+    den = 0.0
+    if base["n"] > 1:
+        den += va ** 2 / (base["n"] - 1)
+    if new["n"] > 1:
+        den += vb ** 2 / (new["n"] - 1)
+    df = max(1.0, num / den) if den > 0 else 1.0
+    t = t_quantile(1.0 - (1.0 - confidence) / 2, df)
+    return diff - t * se, diff + t * se
+
+
+def run_trials(bench, flags, trials):
+    samples = {}
+    for trial in range(trials):
+        sys.stderr.write("trial {0}/{1}\n".format(trial + 1, trials))
+        with tempfile.NamedTemporaryFile(suffix=".json") as out:
+            subprocess.check_call([bench] + flags + ["-o", out.name])
+            report = json.load(open(out.name))
+        for b in report["benchmarks"]:
+            samples.setdefault(b["name"], []).append(b["time"])
+    return dict((name, summary(s)) for name, s in samples.items())
+
+
+def main():
+    parser = OptionParser(usage="%prog [options] [-- fplll_bench options]")
+    parser.add_option("--bench", default="./fplll_bench", help="benchmark program")
+    parser.add_option("--trials", type="int", default=5, help="number of runs of the benchmarks")
+    parser.add_option("--baseline-dir", default="baselines", help="directory of the baselines")
+    parser.add_option("--tolerance", type="float", default=0.05,
+                      help="slowdown (relative to the baseline) that is tolerated")
+    parser.add_option("--confidence", type="float", default=0.95,
+                      help="confidence level of the intervals")
+    parser.add_option("--update", action="store_true", default=False,
+                      help="store the results as the new baseline")
+    (options, flags) = parser.parse_args()
+    if options.trials < 2:
+        parser.error("at least two trials are needed for confidence intervals")
+
+    key, info = machine_fingerprint()
+    baseline_file = os.path.join(options.baseline_dir, key + ".json")
+    results = run_trials(options.bench, flags, options.trials)
+
+    if options.update or not os.path.exists(baseline_file):
+        if not os.path.isdir(options.baseline_dir):
+            os.makedirs(options.baseline_dir)
+        with open(baseline_file, "w") as f:
+            json.dump({"machine": info, "flags": flags, "benchmarks": results}, f, indent=2,
+                      sort_keys=True)
+        print("Baseline for machine {0} written to {1}".format(key, baseline_file))
+        return 0
+
+    baseline = json.load(open(baseline_file))
+    if baseline.get("flags") != flags:
+        sys.stderr.write("warning: baseline was recorded with options {0}\n".format(
+            " ".join(baseline.get("flags", []))))
+
+    print("Machine {0} ({1}), {2:.0%} confidence intervals".format(key, info["cpu"],
+                                                                   options.confidence))
+    print("{0:<28} {1:>10} {2:>10} {3:>19}  {4}".format("benchmark", "base (s)", "new (s)",
+                                                        "change", ""))
+    regressions = 0
+    for name in sorted(results):
+        new = results[name]
+        base = baseline["benchmarks"].get(name)
+        if base is None:
+            print("{0:<28} {1:>10} {2:>10.3f}".format(name, "-", new["mean"]))
+            continue
+        lo, hi = compare(base, new, options.confidence)
+        ref = base["mean"] if base["mean"] > 0 else 1.0
+        status = ""
+        if lo > options.tolerance * ref:
+            status = "REGRESSION"
+            regressions += 1
+        elif hi < -options.tolerance * ref:
+            status = "improvement"
+        print("{0:<28} {1:>10.3f} {2:>10.3f} [{3:>+7.1%}, {4:>+7.1%}]  {5}".format(
+            name, base["mean"], new["mean"], lo / ref, hi / ref, status))
+
+    if regressions:
+        print("{0} regression(s) found".format(regressions))
+        return 1
+    print("No regression found")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
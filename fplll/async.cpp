@@ -0,0 +1,98 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "async.h"
+#include "bkz.h"
+#include "svpcvp.h"
+#include "wrapper.h"
+
+FPLLL_BEGIN_NAMESPACE
+
+ReductionJob launch_reduction_job(std::function<int()> job,
+                                  std::function<reduction_progress_callback> callback)
+{
+  ReductionJob handle;
+  handle.control                             = std::make_shared<ReductionControl>(callback);
+  std::shared_ptr<ReductionControl> control = handle.control;
+  handle.result                              = std::async(std::launch::async, [control, job]() {
+                    ReductionControlScope scope(control.get());
+                    return job();
+                  }).share();
+  return handle;
+}
+
+ReductionJob lll_reduction_async(ZZ_mat<mpz_t> &b, double delta, double eta, LLLMethod method,
+                                 FloatType float_type, int precision, int flags,
+                                 std::function<reduction_progress_callback> callback)
+{
+  return launch_reduction_job(
+      [&b, delta, eta, method, float_type, precision, flags]() {
+        return lll_reduction(b, delta, eta, method, float_type, precision, flags);
+      },
+      callback);
+}
+
+ReductionJob lll_reduction_async(ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u, double delta, double eta,
+                                 LLLMethod method, FloatType float_type, int precision, int flags,
+                                 std::function<reduction_progress_callback> callback)
+{
+  return launch_reduction_job(
+      [&b, &u, delta, eta, method, float_type, precision, flags]() {
+        return lll_reduction(b, u, delta, eta, method, float_type, precision, flags);
+      },
+      callback);
+}
+
+ReductionJob bkz_reduction_async(ZZ_mat<mpz_t> &b, const BKZParam &param, FloatType float_type,
+                                 int precision, std::function<reduction_progress_callback> callback)
+{
+  return launch_reduction_job(
+      [&b, &param, float_type, precision]() {
+        return bkz_reduction(&b, NULL, param, float_type, precision);
+      },
+      callback);
+}
+
+ReductionJob bkz_reduction_async(ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u, const BKZParam &param,
+                                 FloatType float_type, int precision,
+                                 std::function<reduction_progress_callback> callback)
+{
+  return launch_reduction_job(
+      [&b, &u, &param, float_type, precision]() {
+        return bkz_reduction(&b, &u, param, float_type, precision);
+      },
+      callback);
+}
+
+ReductionJob hkz_reduction_async(ZZ_mat<mpz_t> &b, int flags, FloatType float_type, int precision,
+                                 std::function<reduction_progress_callback> callback)
+{
+  return launch_reduction_job(
+      [&b, flags, float_type, precision]() {
+        return hkz_reduction(b, flags, float_type, precision);
+      },
+      callback);
+}
+
+ReductionJob shortest_vector_async(ZZ_mat<mpz_t> &b, vector<Z_NR<mpz_t>> &sol_coord,
+                                   SVPMethod method, int flags,
+                                   std::function<reduction_progress_callback> callback)
+{
+  return launch_reduction_job(
+      [&b, &sol_coord, method, flags]() { return shortest_vector(b, sol_coord, method, flags); },
+      callback);
+}
+
+FPLLL_END_NAMESPACE
@@ -0,0 +1,120 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef FPLLL_ASYNC_H
+#define FPLLL_ASYNC_H
+
+#include "bkz_param.h"
+#include "nr/matrix.h"
+#include "progress.h"
+#include <future>
+#include <memory>
+
+FPLLL_BEGIN_NAMESPACE
+
+class ReductionJob;
+
+/**
+ * @brief Run `job` in a new thread with a ReductionControl attached to it.
+ */
+ReductionJob launch_reduction_job(std::function<int()> job,
+                                  std::function<reduction_progress_callback> callback = nullptr);
+
+/**
+ * @brief Handle on a reduction running in a background thread.
+ *
+ * Jobs are created by the *_async functions below. The matrices (and parameters) passed to these
+ * functions are modified in place by the job and must stay alive and untouched until the job is
+ * done. Destroying the last copy of a handle waits for the job to finish, so a job can be
+ * abandoned by calling cancel() and dropping the handle.
+ */
+class ReductionJob
+{
+public:
+  ReductionJob() {}
+
+  /** false for a default constructed handle **/
+  bool valid() const { return result.valid(); }
+
+  /** request cooperative cancellation, the job then returns RED_CANCELLED **/
+  void cancel() { control->cancel(); }
+
+  /** latest progress reported by the job **/
+  ReductionProgress get_progress() const { return control->get_progress(); }
+
+  /** true if the job is finished **/
+  bool is_done() const { return wait_for(0); }
+
+  /** wait at most `milliseconds` ms, returns true if the job is finished **/
+  bool wait_for(int milliseconds) const
+  {
+    return result.wait_for(std::chrono::milliseconds(milliseconds)) == std::future_status::ready;
+  }
+
+  /** wait for the job and return its status (see RedStatus in defs.h); exceptions thrown by the
+      reduction are rethrown here **/
+  int get() const { return result.get(); }
+
+private:
+  friend ReductionJob launch_reduction_job(std::function<int()> job,
+                                           std::function<reduction_progress_callback> callback);
+
+  std::shared_ptr<ReductionControl> control;
+  std::shared_future<int> result;
+};
+
+/**
+ * @brief Asynchronous lll_reduction (see wrapper.h).
+ */
+ReductionJob lll_reduction_async(ZZ_mat<mpz_t> &b, double delta = LLL_DEF_DELTA,
+                                 double eta = LLL_DEF_ETA, LLLMethod method = LM_WRAPPER,
+                                 FloatType float_type = FT_DEFAULT, int precision = 0,
+                                 int flags                                           = LLL_DEFAULT,
+                                 std::function<reduction_progress_callback> callback = nullptr);
+
+ReductionJob lll_reduction_async(ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u, double delta = LLL_DEF_DELTA,
+                                 double eta = LLL_DEF_ETA, LLLMethod method = LM_WRAPPER,
+                                 FloatType float_type = FT_DEFAULT, int precision = 0,
+                                 int flags                                           = LLL_DEFAULT,
+                                 std::function<reduction_progress_callback> callback = nullptr);
+
+/**
+ * @brief Asynchronous bkz_reduction (see bkz.h). `param` and its strategies must outlive the job.
+ */
+ReductionJob bkz_reduction_async(ZZ_mat<mpz_t> &b, const BKZParam &param,
+                                 FloatType float_type = FT_DEFAULT, int precision = 0,
+                                 std::function<reduction_progress_callback> callback = nullptr);
+
+ReductionJob bkz_reduction_async(ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u, const BKZParam &param,
+                                 FloatType float_type = FT_DEFAULT, int precision = 0,
+                                 std::function<reduction_progress_callback> callback = nullptr);
+
+/**
+ * @brief Asynchronous hkz_reduction (see bkz.h).
+ */
+ReductionJob hkz_reduction_async(ZZ_mat<mpz_t> &b, int flags = HKZ_DEFAULT,
+                                 FloatType float_type = FT_DEFAULT, int precision = 0,
+                                 std::function<reduction_progress_callback> callback = nullptr);
+
+/**
+ * @brief Asynchronous shortest_vector (see svpcvp.h).
+ */
+ReductionJob shortest_vector_async(ZZ_mat<mpz_t> &b, vector<Z_NR<mpz_t>> &sol_coord,
+                                   SVPMethod method = SVPM_PROVED, int flags = SVP_DEFAULT,
+                                   std::function<reduction_progress_callback> callback = nullptr);
+
+FPLLL_END_NAMESPACE
+
+#endif
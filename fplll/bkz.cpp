@@ -19,7 +19,12 @@
 
 #include "bkz.h"
 #include "bkz_param.h"
+#include "context.h"
+#include "decompose.h"
 #include "enum/enumerate.h"
+#include "hbkz.h"
+#include "threadpool.h"
+#include "trace.h"
 #include "util.h"
 #include "wrapper.h"
 #include <iomanip>
@@ -30,12 +35,14 @@ template <class ZT, class FT>
 BKZReduction<ZT, FT>::BKZReduction(MatGSOInterface<ZT, FT> &m, LLLReduction<ZT, FT> &lll_obj,
                                    const BKZParam &param)
     : status(RED_SUCCESS), nodes(0), param(param), m(m), lll_obj(lll_obj), algorithm(NULL),
-      cputime_start(0)
+      cputime_start(0), control(get_reduction_control()), current_tour(0)
 {
   for (num_rows = m.d; num_rows > 0 && m.b_row_is_zero(num_rows - 1); num_rows--)
   {
   }
-  this->delta = param.delta;
+  this->delta        = param.delta;
+  rotated_first      = 0.0;
+  rotated_first_expo = 0;
 }
 
 template <class ZT, class FT> BKZReduction<ZT, FT>::~BKZReduction() {}
@@ -101,13 +108,19 @@ template <class ZT, class FT>
 bool BKZReduction<ZT, FT>::svp_preprocessing(int kappa, unsigned int block_size,
                                              const BKZParam &param)
 {
+  FPLLL_TRACE_ZONE("BKZReduction::svp_preprocessing");
   bool clean = true;
 
   FPLLL_DEBUG_CHECK(param.strategies.size() > block_size);
 
+  if ((param.flags & BKZ_LOCAL_PREPROC) && local_svp_preprocessing(kappa, block_size, param, clean))
+    return clean;
+
   int lll_start = (param.flags & BKZ_BOUNDED_LLL) ? kappa : 0;
   if (!lll_obj.lll(lll_start, lll_start, kappa + block_size, 0))
   {
+    if (lll_obj.status == RED_CANCELLED)
+      throw RED_CANCELLED;
     throw std::runtime_error(RED_STATUS_STR[lll_obj.status]);
   }
   if (lll_obj.n_swaps > 0)
@@ -125,10 +138,109 @@ bool BKZReduction<ZT, FT>::svp_preprocessing(int kappa, unsigned int block_size,
   return clean;
 }
 
+/* Local copies of a block are scaled so that the shortest Gram-Schmidt vector of the block has
+   about 2^BKZ_LOCAL_PREPROC_BITS as norm, and rejected if an entry does not fit in
+   BKZ_LOCAL_PREPROC_MAX_BITS bits. */
+static const int BKZ_LOCAL_PREPROC_BITS     = 24;
+static const int BKZ_LOCAL_PREPROC_MAX_BITS = 40;
+
+template <class ZT, class FT>
+bool BKZReduction<ZT, FT>::local_svp_preprocessing(int kappa, int block_size,
+                                                   const BKZParam &param, bool &clean)
+{
+  // apply_transform adds temporary rows, which is not supported with these options
+  if (m.enable_int_gram || m.enable_inverse_transform)
+    return false;
+
+  // Projection of the block orthogonally to the previous vectors, in the basis of the
+  // Gram-Schmidt vectors of the block: row i is (mu_i0 |b*_0|, ..., mu_i(i-1) |b*_(i-1)|, |b*_i|).
+  FT f;
+  long expo;
+  vector<double> log_norm(block_size);
+  for (int i = 0; i < block_size; ++i)
+  {
+    m.update_gso_row(kappa + i);
+    f           = m.get_r_exp(kappa + i, kappa + i, expo);
+    log_norm[i] = 0.5 * (log2(f.get_d()) + expo);
+    if (!std::isfinite(log_norm[i]))
+      return false;
+  }
+  double scale = BKZ_LOCAL_PREPROC_BITS - *min_element(log_norm.begin(), log_norm.end());
+
+  ZZ_mat<long> local_b, local_u, local_u_inv;
+  local_b.gen_zero(block_size, block_size);
+  local_u.gen_identity(block_size);
+  for (int i = 0; i < block_size; ++i)
+  {
+    for (int j = 0; j <= i; ++j)
+    {
+      double x = 1.0;
+      if (j < i)
+      {
+        m.get_mu(f, kappa + i, kappa + j);
+        x = f.get_d();
+      }
+      x = round(x * exp2(log_norm[j] + scale));
+      if (!(fabs(x) < exp2(BKZ_LOCAL_PREPROC_MAX_BITS)))
+        return false;
+      local_b(i, j) = static_cast<long>(x);
+    }
+  }
+
+  // same steps as the global preprocessing, on the local copy
+  MatGSO<Z_NR<long>, FP_NR<double>> local_m(local_b, local_u, local_u_inv, GSO_DEFAULT);
+  LLLReduction<Z_NR<long>, FP_NR<double>> local_lll(local_m, param.delta, LLL_DEF_ETA,
+                                                     LLL_NO_TARGET);
+  if (!local_lll.lll(0, 0, block_size, 0))
+  {
+    if (local_lll.status == RED_CANCELLED)
+      throw RED_CANCELLED;
+    return false;
+  }
+  BKZReduction<Z_NR<long>, FP_NR<double>> local_bkz(local_m, local_lll, param);
+  auto &preproc = param.strategies[block_size].preprocessing_block_sizes;
+  for (auto it = preproc.begin(); it != preproc.end(); ++it)
+  {
+    int dummy_kappa_max = block_size;
+    BKZParam prepar     = BKZParam(*it, param.strategies, LLL_DEF_DELTA, BKZ_GH_BND);
+    local_bkz.tour(0, dummy_kappa_max, prepar, 0, block_size);
+  }
+
+  // apply the unimodular transformation found locally to the basis, in one pass
+  Matrix<FT> transform(block_size, block_size);
+  bool identity = true;
+  for (int i = 0; i < block_size; ++i)
+  {
+    for (int j = 0; j < block_size; ++j)
+    {
+      long x = local_u(i, j).get_si();
+      if (labs(x) > (1L << 53))
+        return false;
+      transform(i, j) = static_cast<double>(x);
+      identity &= (x == (i == j));
+    }
+  }
+  if (!identity)
+    m.apply_transform(transform, kappa);
+
+  // the local copy is only accurate to BKZ_LOCAL_PREPROC_BITS bits: LLL on the basis restores the
+  // guarantees of the global preprocessing, at the cost of a few swaps at most
+  int lll_start = (param.flags & BKZ_BOUNDED_LLL) ? kappa : 0;
+  if (!lll_obj.lll(lll_start, kappa, kappa + block_size, 0))
+  {
+    if (lll_obj.status == RED_CANCELLED)
+      throw RED_CANCELLED;
+    throw std::runtime_error(RED_STATUS_STR[lll_obj.status]);
+  }
+  clean = identity && lll_obj.n_swaps == 0;
+  return true;
+}
+
 template <class ZT, class FT>
 bool BKZReduction<ZT, FT>::svp_postprocessing(int kappa, int block_size, const vector<FT> &solution,
                                               bool dual)
 {
+  FPLLL_TRACE_ZONE("BKZReduction::svp_postprocessing");
   // Is it already in the basis ?
   int nz_vectors = 0, i_vector = -1;
   for (int i = block_size - 1; i >= 0; i--)
@@ -271,11 +383,39 @@ bool BKZReduction<ZT, FT>::svp_postprocessing_generic(int kappa, int block_size,
   return false;
 }
 
+template <class ZT, class FT>
+void BKZReduction<ZT, FT>::enumeration_radius(int kappa, int block_size, const BKZParam &par,
+                                              bool dual, FT &max_dist, long &max_dist_expo)
+{
+  int first = dual ? kappa + block_size - 1 : kappa;
+  max_dist  = m.get_r_exp(first, first, max_dist_expo);
+  if (dual)
+  {
+    max_dist.pow_si(max_dist, -1, GMP_RNDU);
+    max_dist_expo *= -1;
+  }
+  max_dist *= delta;
+
+  if ((par.flags & BKZ_GH_BND) && block_size > 30)
+  {
+    FT root_det = m.get_root_det(kappa, kappa + block_size);
+    adjust_radius_to_gh_bound(max_dist, max_dist_expo, block_size, root_det, par.gh_factor);
+  }
+}
+
 template <class ZT, class FT>
 bool BKZReduction<ZT, FT>::svp_reduction(int kappa, int block_size, const BKZParam &par, bool dual)
 {
+  FPLLL_TRACE_ZONE("BKZReduction::svp_reduction");
   int first = dual ? kappa + block_size - 1 : kappa;
 
+  if (control)
+  {
+    if (control->is_cancelled())
+      throw RED_CANCELLED;
+    control->report_bkz(kappa, current_tour);
+  }
+
   // ensure we are computing something sensible.
   // note that the size reduction here is required, since
   // we're calling this function on unreduced blocks at times
@@ -306,21 +446,9 @@ bool BKZReduction<ZT, FT>::svp_reduction(int kappa, int block_size, const BKZPar
 
     svp_preprocessing(kappa, block_size, par);
 
-    // compute enumeration radius
     long max_dist_expo;
-    FT max_dist = m.get_r_exp(first, first, max_dist_expo);
-    if (dual)
-    {
-      max_dist.pow_si(max_dist, -1, GMP_RNDU);
-      max_dist_expo *= -1;
-    }
-    max_dist *= delta;
-
-    if ((par.flags & BKZ_GH_BND) && block_size > 30)
-    {
-      FT root_det = m.get_root_det(kappa, kappa + block_size);
-      adjust_radius_to_gh_bound(max_dist, max_dist_expo, block_size, root_det, par.gh_factor);
-    }
+    FT max_dist;
+    enumeration_radius(kappa, block_size, par, dual, max_dist, max_dist_expo);
 
     const PruningParams &pruning = get_pruning(kappa, block_size, par);
 
@@ -331,6 +459,10 @@ bool BKZReduction<ZT, FT>::svp_reduction(int kappa, int block_size, const BKZPar
                        vector<enumxt>(), pruning.coefficients, dual);
     nodes += enum_obj.get_nodes();
 
+    // the enumeration stops early when cancelled, its result cannot be trusted
+    if (control && control->is_cancelled())
+      throw RED_CANCELLED;
+
     if (!evaluator.empty())
     {
       svp_postprocessing(kappa, block_size, evaluator.begin()->second, dual);
@@ -347,6 +479,8 @@ bool BKZReduction<ZT, FT>::svp_reduction(int kappa, int block_size, const BKZPar
   {
     throw std::runtime_error(RED_STATUS_STR[lll_obj.status]);
   }
+  if (lll_obj.meets_target(first))
+    throw RED_CANCELLED;
 
   // in order to check if we made progress, we compare the new shortest vector to the
   // old one (note that simply checking clean flags is not sufficient since
@@ -354,6 +488,8 @@ bool BKZReduction<ZT, FT>::svp_reduction(int kappa, int block_size, const BKZPar
   long new_first_expo;
   FT new_first = m.get_r_exp(first, first, new_first_expo);
   new_first.mul_2si(new_first, new_first_expo - old_first_expo);
+  if (par.flags & BKZ_ROTATIONS)
+    insert_rotations(par);
   return (dual) ? (old_first >= new_first) : (old_first <= new_first);
 }
 
@@ -362,7 +498,10 @@ bool BKZReduction<ZT, FT>::tour(const int loop, int &kappa_max, const BKZParam &
                                 int max_row)
 {
   bool clean = true;
-  clean &= trunc_tour(kappa_max, par, min_row, max_row);
+  if (par.flags & BKZ_PARALLEL)
+    clean &= parallel_trunc_tour(par, min_row, max_row);
+  else
+    clean &= trunc_tour(kappa_max, par, min_row, max_row);
   clean &= hkz(kappa_max, par, max(max_row - par.block_size, 0), max_row);
 
   if (par.flags & BKZ_VERBOSE)
@@ -402,6 +541,315 @@ bool BKZReduction<ZT, FT>::trunc_tour(int &kappa_max, const BKZParam &par, int m
   return clean;
 }
 
+template <class ZT, class FT>
+bool BKZReduction<ZT, FT>::parallel_trunc_tour(const BKZParam &par, int min_row, int max_row)
+{
+  bool clean     = true;
+  int block_size = par.block_size;
+  for (int s = 0; s < block_size && min_row + s < max_row - block_size; ++s)
+  {
+    vector<int> kappas;
+    for (int kappa = min_row + s; kappa < max_row - block_size; kappa += block_size)
+      kappas.push_back(kappa);
+    clean &= parallel_svp_reduction(kappas, block_size, par);
+  }
+  return clean;
+}
+
+template <class ZT, class FT>
+bool BKZReduction<ZT, FT>::parallel_svp_reduction(const vector<int> &kappas, int block_size,
+                                                  const BKZParam &par)
+{
+  FPLLL_TRACE_ZONE("BKZReduction::parallel_svp_reduction");
+  const int n_blocks = kappas.size();
+
+  if (control)
+  {
+    if (control->is_cancelled())
+      throw RED_CANCELLED;
+    control->report_bkz(kappas[0], current_tour);
+  }
+
+  // The blocks are independent as long as every operation stays inside its block: insertions
+  // only combine vectors of the block and LLL must not move vectors across block boundaries.
+  BKZParam bounded_par = par;
+  bounded_par.flags |= BKZ_BOUNDED_LLL;
+
+  vector<FT> old_first(n_blocks);
+  vector<long> old_first_expo(n_blocks);
+  for (int i = 0; i < n_blocks; ++i)
+  {
+    if (!lll_obj.size_reduction(0, kappas[i] + 1, 0))
+    {
+      throw std::runtime_error(RED_STATUS_STR[lll_obj.status]);
+    }
+    if (lll_obj.meets_target(kappas[i]))
+      throw RED_CANCELLED;
+    old_first[i] = FT(m.get_r_exp(kappas[i], kappas[i], old_first_expo[i]));
+  }
+
+  vector<double> remaining_probability(n_blocks, 1.0);
+  vector<bool> rerandomize(n_blocks, false);
+  vector<FT> max_dist(n_blocks);
+  vector<long> max_dist_expo(n_blocks);
+  vector<const PruningParams *> pruning(n_blocks);
+  vector<vector<FT>> solution(n_blocks);
+  vector<uint64_t> block_nodes(n_blocks);
+  vector<int> active;
+
+  while (true)
+  {
+    active.clear();
+    for (int i = 0; i < n_blocks; ++i)
+    {
+      if (remaining_probability[i] > 1. - par.min_success_probability)
+        active.push_back(i);
+    }
+    if (active.empty())
+      break;
+
+    for (int i : active)
+    {
+      if (rerandomize[i])
+      {
+        rerandomize_block(kappas[i] + 1, kappas[i] + block_size, par.rerandomization_density);
+      }
+      svp_preprocessing(kappas[i], block_size, bounded_par);
+    }
+
+    // from here on the enumerations only read the GSO, so it must be up to date
+    for (int i = 0; i < kappas.back() + block_size; ++i)
+      m.update_gso_row(i);
+    for (int i : active)
+    {
+      enumeration_radius(kappas[i], block_size, par, false, max_dist[i], max_dist_expo[i]);
+      pruning[i] = &get_pruning(kappas[i], block_size, par);
+      FPLLL_DEBUG_CHECK(pruning[i]->metric == PRUNER_METRIC_PROBABILITY_OF_SHORTEST)
+    }
+
+    auto enumerate_block = [&](int i) {
+      FastEvaluator<FT> block_evaluator;
+      Enumeration<ZT, FT> enum_obj(m, block_evaluator);
+      enum_obj.enumerate(kappas[i], kappas[i] + block_size, max_dist[i], max_dist_expo[i],
+                         vector<FT>(), vector<enumxt>(), pruning[i]->coefficients);
+      block_nodes[i] = enum_obj.get_nodes();
+      solution[i].clear();
+      if (!block_evaluator.empty())
+        solution[i] = block_evaluator.begin()->second;
+    };
+
+    // thread budget: either several blocks at once with one thread each, or one block at a time
+    // with all the threads of the threadpool
+    int n_active = active.size();
+    int threads  = get_threads();
+    int n_jobs   = par.parallel_blocks;
+    if (n_jobs <= 0)
+      n_jobs = (get_external_enumerator() && n_active < threads) ? 1 : threads;
+    n_jobs = min(n_jobs, min(n_active, threads));
+
+    if (n_jobs == 1)
+    {
+      for (int i : active)
+        enumerate_block(i);
+    }
+    else
+    {
+      std::atomic<int> next(0);
+      std::exception_ptr error;
+      std::mutex error_mutex;
+      unsigned int prec         = FT::get_prec();
+      ReductionContext *context = get_reduction_context();
+      auto job                  = [&]() {
+        ReductionContextScope context_scope(context);
+        unsigned int old_prec = FT::set_prec(prec);
+        int old_cap           = set_enumeration_threads(1);
+        ReductionControlScope control_scope(control);
+        try
+        {
+          for (int j = next++; j < n_active; j = next++)
+            enumerate_block(active[j]);
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          error = std::current_exception();
+        }
+        set_enumeration_threads(old_cap);
+        FT::set_prec(old_prec);
+      };
+      thread_pool::thread_pool &pool = get_threadpool();
+      for (int j = 0; j < n_jobs; ++j)
+        pool.push(job);
+      pool.wait_work();
+      if (error)
+        std::rethrow_exception(error);
+    }
+
+    // the enumerations stop early when cancelled, their results cannot be trusted
+    if (control && control->is_cancelled())
+      throw RED_CANCELLED;
+
+    for (int i : active)
+    {
+      nodes += block_nodes[i];
+      if (!solution[i].empty())
+      {
+        svp_postprocessing(kappas[i], block_size, solution[i]);
+        rerandomize[i] = false;
+      }
+      else
+      {
+        rerandomize[i] = true;
+      }
+      remaining_probability[i] *= (1 - pruning[i]->expectation);
+    }
+  }
+
+  bool clean = true;
+  for (int i = 0; i < n_blocks; ++i)
+  {
+    if (!lll_obj.size_reduction(0, kappas[i] + 1, 0))
+    {
+      throw std::runtime_error(RED_STATUS_STR[lll_obj.status]);
+    }
+    if (lll_obj.meets_target(kappas[i]))
+      throw RED_CANCELLED;
+    long new_first_expo;
+    FT new_first = m.get_r_exp(kappas[i], kappas[i], new_first_expo);
+    new_first.mul_2si(new_first, new_first_expo - old_first_expo[i]);
+    clean &= (old_first[i] <= new_first);
+  }
+  if (par.flags & BKZ_ROTATIONS)
+    insert_rotations(par);
+  return clean;
+}
+
+/* svp_postprocessing computes the gcd of the coordinates by subtractions, the rotations whose
+   coordinates reach this bound are not inserted */
+static const double ROTATION_MAX_COORD = 1 << 20;
+
+template <class ZT, class FT> void BKZReduction<ZT, FT>::insert_rotations(const BKZParam &par)
+{
+  FPLLL_TRACE_ZONE("BKZReduction::insert_rotations");
+  Matrix<ZT> &b = dynamic_cast<MatGSO<ZT, FT> &>(m).b;
+  const int n      = b.get_cols();
+  const int degree = par.rotation_degree > 0 ? par.rotation_degree : n / 2;
+
+  // nothing to do unless b_0 became shorter since the last call
+  long first_expo;
+  FT first_norm = m.get_r_exp(0, 0, first_expo);
+  FT last_norm  = rotated_first;
+  last_norm.mul_2si(last_norm, rotated_first_expo - first_expo);
+  if (!rotated_first.is_zero() && first_norm >= last_norm)
+    return;
+  rotated_first      = first_norm;
+  rotated_first_expo = first_expo;
+
+  // the rotations are only worth inserting for an unusually short b_0, below the Gaussian
+  // heuristic of the lattice (typically the secret key of an NTRU-like lattice)
+  m.update_gso();
+  FT gh_norm  = first_norm;
+  FT root_det = m.get_root_det(0, num_rows);
+  adjust_radius_to_gh_bound(gh_norm, first_expo, num_rows, root_det, 1.0);
+  if (gh_norm < first_norm)
+    return;
+
+  vector<ZT> first(n), w(n);
+  for (int c = 0; c < n; ++c)
+    first[c] = b(0, c);
+  vector<FT> t(num_rows), x(num_rows);
+  FT f, g, norm;
+  ZT z, zt;
+  for (int k = 1; k < degree; ++k)
+  {
+    for (int c = 0; c < n; ++c)
+      w[c] = first[c - c % degree + (c % degree + degree - k) % degree];
+
+    // coordinates of w in the Gram-Schmidt basis
+    m.update_gso();
+    for (int j = 0; j < num_rows; ++j)
+    {
+      t[j] = 0.0;
+      if (m.b_row_is_zero(j))
+        continue;
+      z = 0;
+      for (int c = 0; c < n; ++c)
+        z.addmul(w[c], b(j, c));
+      t[j].set_z(z);
+      for (int i = 0; i < j; ++i)
+      {
+        m.get_r(f, j, i);
+        t[j].submul(f, t[i]);
+      }
+      m.get_r(f, j, j);
+      t[j].div(t[j], f);
+    }
+
+    // w is inserted at the first index where its projection is shorter than delta times the
+    // Gram-Schmidt vector, if there is one
+    int kappa = 0;
+    norm      = 0.0;
+    for (int i = num_rows - 1; i > 0; --i)
+    {
+      m.get_r(f, i, i);
+      g.mul(t[i], t[i]);
+      norm.addmul(g, f);
+      g.mul(f, delta);
+      if (norm < g)
+        kappa = i;
+    }
+    if (kappa == 0)
+      continue;
+
+    // coordinates in the basis, rounded with Babai's nearest plane algorithm, which must be exact
+    // in FT for row_addmul and must give w back
+    bool exact = true;
+    for (int j = num_rows - 1; j >= 0 && exact; --j)
+    {
+      x[j].rnd(t[j]);
+      zt.set_f(x[j]);
+      g.set_z(zt);
+      exact = (g == x[j]);
+      for (int i = 0; i < j; ++i)
+      {
+        m.get_mu(f, j, i);
+        t[i].submul(f, x[j]);
+      }
+    }
+    for (int c = 0; c < n && exact; ++c)
+    {
+      z = w[c];
+      for (int j = 0; j < num_rows; ++j)
+      {
+        zt.set_f(x[j]);
+        z.submul(zt, b(j, c));
+      }
+      exact = z.is_zero();
+    }
+    if (!exact)
+      continue;
+
+    // the projection of w orthogonally to b_0, ..., b_(kappa - 1) is inserted as in BKZ, from its
+    // coordinates in b_kappa, ..., b_(num_rows - 1)
+    vector<FT> solution(x.begin() + kappa, x.end());
+    bool small = true, new_vector = false;
+    for (int j = 0; j < num_rows - kappa && small; ++j)
+    {
+      small = fabs(solution[j].get_d()) < ROTATION_MAX_COORD;
+      new_vector |= (j > 0 && !solution[j].is_zero());
+    }
+    if (!small || !new_vector)
+      continue;
+    svp_postprocessing(kappa, num_rows - kappa, solution);
+    if (!lll_obj.lll(0, kappa, num_rows, 0))
+    {
+      if (lll_obj.status == RED_CANCELLED)
+        throw RED_CANCELLED;
+      throw std::runtime_error(RED_STATUS_STR[lll_obj.status]);
+    }
+  }
+}
+
 template <class ZT, class FT>
 bool BKZReduction<ZT, FT>::trunc_dtour(const BKZParam &par, int min_row, int max_row)
 {
@@ -483,6 +931,8 @@ bool BKZReduction<ZT, FT>::slide_tour(const int loop, const BKZParam &par, int m
     {
       if (!lll_obj.lll(min_row, min_row, max_row, 0))
       {
+        if (lll_obj.status == RED_CANCELLED)
+          throw RED_CANCELLED;
         throw std::runtime_error(RED_STATUS_STR[lll_obj.status]);
       }
       if (lll_obj.n_swaps > 0)
@@ -533,6 +983,17 @@ template <class ZT, class FT> bool BKZReduction<ZT, FT>::bkz()
     throw std::runtime_error("Invalid flags: SD-BKZ and Slide reduction are mutually exclusive!");
   }
 
+  if (flags & BKZ_ROTATIONS)
+  {
+    MatGSO<ZT, FT> *gso = dynamic_cast<MatGSO<ZT, FT> *>(&m);
+    if (!gso)
+      throw std::runtime_error("Invalid flags: BKZ_ROTATIONS needs a MatGSO object!");
+    int n      = gso->b.get_cols();
+    int degree = param.rotation_degree > 0 ? param.rotation_degree : n / 2;
+    if (degree < 2 || n % degree != 0)
+      throw std::runtime_error("Invalid rotation degree: must divide the number of columns!");
+  }
+
   if (flags & BKZ_DUMP_GSO)
   {
     dump_gso(param.dump_gso_filename, false, "Input", -1, 0.0);
@@ -594,7 +1055,10 @@ template <class ZT, class FT> bool BKZReduction<ZT, FT>::bkz()
     {
       break;
     }
+    if (control && control->is_cancelled())
+      return set_status(RED_CANCELLED);
 
+    current_tour = i;
     try
     {
       if (sd)
@@ -615,6 +1079,9 @@ template <class ZT, class FT> bool BKZReduction<ZT, FT>::bkz()
       return set_status(e);
     }
 
+    if (control)
+      control->report_tour(i, m.get_current_slope(0, num_rows));
+
     // if we do hkz reduction, we only need one tour
     if (clean || param.block_size >= num_rows)
       break;
@@ -807,16 +1274,41 @@ template <class ZT, class FT> bool BKZAutoAbort<ZT, FT>::test_abort(double scale
   return no_dec >= maxNoDec;
 }
 
+// call BKZReduction, or HBKZReduction for BKZ_METHOD_HOUSEHOLDER.
+template <class ZT, class FT>
+int bkz_reduction_zf(ZZ_mat<ZT> &b, const BKZParam &param, int sel_ft, double lll_delta,
+                     ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv)
+{
+  if (param.method == BKZ_METHOD_HOUSEHOLDER)
+  {
+    int householder_flags = 0;
+    if (sel_ft == FT_DOUBLE || sel_ft == FT_LONG_DOUBLE)
+      householder_flags |= HOUSEHOLDER_ROW_EXPO;
+    MatHouseholder<Z_NR<ZT>, FT> m_householder(b, u, u_inv, householder_flags);
+    HLLLReduction<Z_NR<ZT>, FT> hlll_obj(m_householder, lll_delta, LLL_DEF_ETA, HLLL_DEF_THETA,
+                                         HLLL_DEF_C, LLL_DEFAULT);
+    HBKZReduction<Z_NR<ZT>, FT> bkz_obj(m_householder, hlll_obj, param);
+    bkz_obj.bkz();
+    return bkz_obj.status;
+  }
+
+  int gso_flags = 0;
+  if (sel_ft == FT_DOUBLE || sel_ft == FT_LONG_DOUBLE)
+    gso_flags |= GSO_ROW_EXPO;
+  MatGSO<Z_NR<ZT>, FT> m_gso(b, u, u_inv, gso_flags);
+  LLLReduction<Z_NR<ZT>, FT> lll_obj(m_gso, lll_delta, LLL_DEF_ETA, LLL_DEFAULT);
+  BKZReduction<Z_NR<ZT>, FT> bkz_obj(m_gso, lll_obj, param);
+  bkz_obj.bkz();
+  return bkz_obj.status;
+}
+
 // call LLLReduction() and then BKZReduction.
 template <class FT>
 int bkz_reduction_f(ZZ_mat<mpz_t> &b, const BKZParam &param, int sel_ft, double lll_delta,
                     ZZ_mat<mpz_t> &u, ZZ_mat<mpz_t> &u_inv)
 {
-  int gso_flags = 0;
   if (b.get_rows() == 0 || b.get_cols() == 0)
     return RED_SUCCESS;
-  if (sel_ft == FT_DOUBLE || sel_ft == FT_LONG_DOUBLE)
-    gso_flags |= GSO_ROW_EXPO;
   ZZ_mat<long> bl;
   // we check if we can convert the basis to long integers for performance
   if (convert<long, mpz_t>(bl, b, 10))
@@ -826,23 +1318,16 @@ int bkz_reduction_f(ZZ_mat<mpz_t> &b, const BKZParam &param, int sel_ft, double
     ZZ_mat<long> ul_inv;
     convert<long, mpz_t>(ul_inv, u_inv, 0);
 
-    MatGSO<Z_NR<long>, FT> m_gso(bl, ul, ul_inv, gso_flags);
-    LLLReduction<Z_NR<long>, FT> lll_obj(m_gso, lll_delta, LLL_DEF_ETA, LLL_DEFAULT);
-    BKZReduction<Z_NR<long>, FT> bkz_obj(m_gso, lll_obj, param);
-    bkz_obj.bkz();
+    int status = bkz_reduction_zf<long, FT>(bl, param, sel_ft, lll_delta, ul, ul_inv);
 
     convert<mpz_t, long>(b, bl, 0);
     convert<mpz_t, long>(u, ul, 0);
     convert<mpz_t, long>(u_inv, ul_inv, 0);
-    return bkz_obj.status;
+    return status;
   }
   else
   {
-    MatGSO<Z_NR<mpz_t>, FT> m_gso(b, u, u_inv, gso_flags);
-    LLLReduction<Z_NR<mpz_t>, FT> lll_obj(m_gso, lll_delta, LLL_DEF_ETA, LLL_DEFAULT);
-    BKZReduction<Z_NR<mpz_t>, FT> bkz_obj(m_gso, lll_obj, param);
-    bkz_obj.bkz();
-    return bkz_obj.status;
+    return bkz_reduction_zf<mpz_t, FT>(b, param, sel_ft, lll_delta, u, u_inv);
   }
 }
 
@@ -866,14 +1351,36 @@ int bkz_reduction(ZZ_mat<mpz_t> *B, ZZ_mat<mpz_t> *U, const BKZParam &param, Flo
   FPLLL_CHECK(!(sel_ft == FT_MPFR && precision == 0),
               "Missing precision for BKZ with floating point type mpfr");
 
+  /* orthogonal components reduced independently with standard BKZ, then the whole basis */
+  if (param.flags & BKZ_DECOMPOSE)
+  {
+    BKZParam component_param = param;
+    component_param.flags &=
+        ~(BKZ_DECOMPOSE | BKZ_DUMP_GSO | BKZ_ROTATIONS | BKZ_SD_VARIANT | BKZ_SLD_RED);
+    int status = reduce_components<mpz_t>(
+        *B, u, u_inv, [&](ZZ_mat<mpz_t> &bc, ZZ_mat<mpz_t> &uc, ZZ_mat<mpz_t> &) {
+          BKZParam par = component_param;
+          if (bc.get_rows() < 2)
+            return static_cast<int>(RED_SUCCESS);
+          par.block_size = min(par.block_size, bc.get_rows());
+          return bkz_reduction(&bc, uc.empty() ? NULL : &uc, par, float_type, precision);
+        });
+    if (status != RED_SUCCESS)
+    {
+      zeros_first(*B, u, u_inv);
+      return target_status(*B, status);
+    }
+  }
+
   /* lllwrapper (no FloatType needed, -m ignored) */
   if (param.flags & BKZ_NO_LLL)
     zeros_last(*B, u, u_inv);
   else
   {
-    Wrapper wrapper(*B, u, u_inv, lll_delta, LLL_DEF_ETA, LLL_DEFAULT);
+    int lll_flags = (param.flags & BKZ_QARY) ? LLL_QARY : LLL_DEFAULT;
+    Wrapper wrapper(*B, u, u_inv, lll_delta, LLL_DEF_ETA, lll_flags);
     if (!wrapper.lll())
-      return wrapper.status;
+      return target_status(*B, wrapper.status);
   }
 
   /* bkz (with float_type) */
@@ -924,7 +1431,7 @@ int bkz_reduction(ZZ_mat<mpz_t> *B, ZZ_mat<mpz_t> *U, const BKZParam &param, Flo
     }
   }
   zeros_first(*B, u, u_inv);
-  return status;
+  return target_status(*B, status);
 }
 
 int bkz_reduction(ZZ_mat<mpz_t> &b, int block_size, int flags, FloatType float_type, int precision)
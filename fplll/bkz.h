@@ -315,6 +315,21 @@ private:
   // a truncated dual tour: dual svp reducing from max_row to min_row without decreasing
   // the window size (simply returns when the first block is reduced)
   bool trunc_dtour(const BKZParam &param, int min_row, int max_row);
+  // a truncated tour run as block_size sweeps over disjoint blocks (see BKZ_PARALLEL): the sweep
+  // with offset s reduces the blocks starting at min_row + s, min_row + s + block_size, ...
+  bool parallel_trunc_tour(const BKZParam &param, int min_row, int max_row);
+  // svp reduction of the disjoint blocks starting at the rows in `kappas`, whose enumerations
+  // run concurrently on the threadpool
+  bool parallel_svp_reduction(const vector<int> &kappas, int block_size, const BKZParam &param);
+  // preprocessing of the block in local coordinates (see BKZ_LOCAL_PREPROC), returns false if
+  // the block cannot be represented locally, in which case the basis is left unchanged
+  bool local_svp_preprocessing(int kappa, int block_size, const BKZParam &param, bool &clean);
+  // if b_0 became shorter, inserts its other rotations (see BKZ_ROTATIONS) in the basis, each at
+  // the first index where it improves the Gram-Schmidt vector, followed by LLL
+  void insert_rotations(const BKZParam &par);
+  // enumeration radius for the block of size block_size starting at kappa
+  void enumeration_radius(int kappa, int block_size, const BKZParam &param, bool dual,
+                          FT &max_dist, long &max_dist_expo);
 
   const BKZParam &param;
   int num_rows;
@@ -330,11 +345,19 @@ private:
   // current value of the potential function as defined in the slide reduction paper
   // used to reliably determine terminating condition during slide reduction
   FT sld_potential;
+  // squared norm of b_0 (times 2^rotated_first_expo) when insert_rotations last looked at it, zero
+  // if it did not yet
+  FT rotated_first;
+  long rotated_first_expo;
 
   // Temporary data
   const vector<FT> empty_target, empty_sub_tree;
   FT max_dist, delta_max_dist;
   double cputime_start;
+
+  // Control attached to the thread when the object was created (see progress.h)
+  ReductionControl *control;
+  int current_tour;
 };
 
 /**
@@ -91,6 +91,15 @@ public:
           - BKZ_GH_BND        use the Gaussian heuristic to reduce the enumeration bound of possible
           - BKZ_SD_VARIANT    run SD-BKZ
           - BKZ_SLD_RED       run slide reduction
+          - BKZ_PARALLEL      run tours as sweeps of disjoint blocks reduced concurrently (see
+     parallel_blocks)
+          - BKZ_LOCAL_PREPROC preprocess blocks on a small copy of the projected block and apply
+     the transformation to the basis once
+          - BKZ_ROTATIONS     insert all the rotations of each new shortest vector (for NTRU-like
+     and cyclic lattices, see rotation_degree)
+          - BKZ_QARY          run the initial LLL with LLL_QARY (for q-ary bases built by gen_qary)
+          - BKZ_DECOMPOSE     first reduce the orthogonal components of the basis independently
+     and in parallel with standard BKZ (see reduce_components)
      @param max_loops
         maximum number of loops (or zero to disable this)
      @param max_time
@@ -118,7 +127,8 @@ public:
         max_loops(max_loops), max_time(max_time), auto_abort_scale(auto_abort_scale),
         auto_abort_max_no_dec(auto_abort_max_no_dec), gh_factor(gh_factor),
         dump_gso_filename("gso.json"), min_success_probability(min_success_probability),
-        rerandomization_density(rerandomization_density)
+        rerandomization_density(rerandomization_density), parallel_blocks(0),
+        method(BKZ_METHOD_GSO), rotation_degree(0)
   {
 
     // we create dummy strategies
@@ -173,6 +183,33 @@ public:
   /** density of rerandomization operation when using extreme pruning **/
 
   int rerandomization_density;
+
+  /** If BKZ_PARALLEL is set, the number of blocks whose enumerations run concurrently, each in
+      one thread of the threadpool (see set_threads). With 1, the blocks of a sweep are enumerated
+      one after the other with all the threads. With 0, the blocks run concurrently when a sweep
+      has at least as many blocks as there are threads or when no external enumerator is used.
+      BKZ_PARALLEL only changes standard BKZ tours (not BKZ_SD_VARIANT or BKZ_SLD_RED), and
+      progress callbacks may then be called from threads of the threadpool.
+  */
+
+  int parallel_blocks;
+
+  /** Orthogonalisation used by bkz_reduction: BKZ_METHOD_GSO runs BKZReduction on MatGSO,
+      BKZ_METHOD_HOUSEHOLDER runs HBKZReduction on MatHouseholder (see hbkz.h), which keeps the
+      basis HLLL-reduced and solves every block on a local copy of its R factor.
+  */
+
+  BKZMethod method;
+
+  /** If BKZ_ROTATIONS is set, the lattice is assumed to be closed under the rotation which shifts
+      cyclically by one position each block of rotation_degree consecutive coordinates, as the
+      NTRU-like lattices of gen_ntrulike (basis vectors (x^i, x^i h) mod x^n - 1). When a tour
+      finds a new first vector b_0, its rotation_degree - 1 other rotations, which are as short,
+      are inserted in the basis wherever they improve a Gram-Schmidt vector. With 0, the degree
+      is half the number of columns.
+  */
+
+  int rotation_degree;
 };
 
 /**
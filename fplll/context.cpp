@@ -0,0 +1,102 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "context.h"
+#include "bkz.h"
+#include "svpcvp.h"
+#include "wrapper.h"
+
+FPLLL_BEGIN_NAMESPACE
+
+static thread_local ReductionContext *current_context = nullptr;
+
+ReductionContext *get_reduction_context() { return current_context; }
+
+ReductionContext::ReductionContext(unsigned long seed, int threads)
+    : precision(0), external_enumerator(get_external_enumerator()),
+      pool(threads > 1 ? threads - 1 : 0)
+{
+  gmp_randinit_default(gmp_state);
+  gmp_randseed_ui(gmp_state, seed);
+}
+
+ReductionContext::~ReductionContext() { gmp_randclear(gmp_state); }
+
+ReductionContextScope::ReductionContextScope(ReductionContext *context)
+    : previous(current_context), previous_prec(0)
+{
+  current_context = context;
+  if (context == nullptr)
+  {
+    previous_state   = RandGen::set_local_state(nullptr);
+    previous_extenum = set_local_external_enumerator(nullptr);
+    previous_pool    = set_local_threadpool(nullptr);
+    return;
+  }
+  previous_state   = RandGen::set_local_state(&context->get_gmp_state());
+  previous_extenum = set_local_external_enumerator(&context->external_enumerator);
+  previous_pool    = set_local_threadpool(&context->pool);
+  if (context->precision > 0)
+    previous_prec = FP_NR<mpfr_t>::set_prec(context->precision);
+}
+
+ReductionContextScope::~ReductionContextScope()
+{
+  if (previous_prec > 0)
+    FP_NR<mpfr_t>::set_prec(previous_prec);
+  set_local_threadpool(previous_pool);
+  set_local_external_enumerator(previous_extenum);
+  RandGen::set_local_state(previous_state);
+  current_context = previous;
+}
+
+int lll_reduction(ReductionContext &context, ZZ_mat<mpz_t> &b, double delta, double eta,
+                  LLLMethod method, FloatType float_type, int precision, int flags,
+                  LLLStats *stats)
+{
+  ReductionContextScope scope(&context);
+  return lll_reduction(b, delta, eta, method, float_type, precision, flags, stats);
+}
+
+int lll_reduction(ReductionContext &context, ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u, double delta,
+                  double eta, LLLMethod method, FloatType float_type, int precision, int flags,
+                  LLLStats *stats)
+{
+  ReductionContextScope scope(&context);
+  return lll_reduction(b, u, delta, eta, method, float_type, precision, flags, stats);
+}
+
+int bkz_reduction(ReductionContext &context, ZZ_mat<mpz_t> &b, const BKZParam &param,
+                  FloatType float_type, int precision)
+{
+  ReductionContextScope scope(&context);
+  return bkz_reduction(&b, NULL, param, float_type, precision);
+}
+
+int bkz_reduction(ReductionContext &context, ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u,
+                  const BKZParam &param, FloatType float_type, int precision)
+{
+  ReductionContextScope scope(&context);
+  return bkz_reduction(&b, &u, param, float_type, precision);
+}
+
+int shortest_vector(ReductionContext &context, ZZ_mat<mpz_t> &b, vector<Z_NR<mpz_t>> &sol_coord,
+                    SVPMethod method, int flags)
+{
+  ReductionContextScope scope(&context);
+  return shortest_vector(b, sol_coord, method, flags);
+}
+
+FPLLL_END_NAMESPACE
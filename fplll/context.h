@@ -0,0 +1,130 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef FPLLL_CONTEXT_H
+#define FPLLL_CONTEXT_H
+
+#include "bkz_param.h"
+#include "counters.h"
+#include "enum/enumerate_ext.h"
+#include "nr/matrix.h"
+#include "threadpool.h"
+
+FPLLL_BEGIN_NAMESPACE
+
+/**
+ * @brief State of the library used by the reductions of one thread.
+ *
+ * By default, the reductions share the state of the process: the random generator RandGen, the
+ * external enumerator (see set_external_enumerator), the global threadpool and the default
+ * precision of FP_NR<mpfr_t>. A context holds its own copy of this state, so that independent
+ * reductions can run concurrently in several threads of the same process, each with its own
+ * context.
+ *
+ * A context is attached to the calling thread with ReductionContextScope, or by passing it to
+ * one of the functions below. While it is attached, RandGen::get_gmp_state(), RandGenInt,
+ * get/set_external_enumerator, get/set_threads and FP_NR<mpfr_t>::set_prec only touch the context.
+ * Each thread running a reduction needs its own context; the threads started by a reduction
+ * (e.g. BKZ_PARALLEL) attach the context of the reduction.
+ *
+ * The precision of FP_NR<mpfr_t> is only private to the thread if MPFR is built thread safe,
+ * which is the default.
+ */
+class ReductionContext
+{
+public:
+  /**
+   * @param seed     seed of the random generator of the context
+   * @param threads  number of threads of the threadpool of the context (see set_threads)
+   */
+  ReductionContext(unsigned long seed = 0, int threads = 1);
+  ~ReductionContext();
+
+  /** reseed the random generator of the context **/
+  void set_seed(unsigned long seed) { gmp_randseed_ui(gmp_state, seed); }
+
+  gmp_randstate_t &get_gmp_state() { return gmp_state; }
+
+  /** default precision of FP_NR<mpfr_t> while the context is attached, 0 keeps the precision of
+      the thread **/
+  unsigned int precision;
+
+  /** external enumerator of the context, initialised with the one of the process **/
+  std::function<extenum_fc_enumerate> external_enumerator;
+
+  /** threadpool of the context, with threads - 1 pooled threads (see threadpool.h) **/
+  thread_pool::thread_pool pool;
+
+private:
+  ReductionContext(const ReductionContext &) = delete;
+  ReductionContext &operator=(const ReductionContext &) = delete;
+
+  gmp_randstate_t gmp_state;
+};
+
+/**
+ * @brief Context attached to the calling thread, or nullptr if there is none.
+ */
+ReductionContext *get_reduction_context();
+
+/**
+ * @brief Attaches a context to the calling thread for the lifetime of this object. Attaching
+ * nullptr restores the state of the process.
+ */
+class ReductionContextScope
+{
+public:
+  ReductionContextScope(ReductionContext *context);
+  ~ReductionContextScope();
+
+private:
+  ReductionContext *previous;
+  gmp_randstate_t *previous_state;
+  std::function<extenum_fc_enumerate> *previous_extenum;
+  thread_pool::thread_pool *previous_pool;
+  unsigned int previous_prec;
+};
+
+/**
+ * @brief lll_reduction (see wrapper.h) with `context` attached to the calling thread.
+ */
+int lll_reduction(ReductionContext &context, ZZ_mat<mpz_t> &b, double delta = LLL_DEF_DELTA,
+                  double eta = LLL_DEF_ETA, LLLMethod method = LM_WRAPPER,
+                  FloatType float_type = FT_DEFAULT, int precision = 0, int flags = LLL_DEFAULT,
+                  LLLStats *stats = nullptr);
+
+int lll_reduction(ReductionContext &context, ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u,
+                  double delta = LLL_DEF_DELTA, double eta = LLL_DEF_ETA,
+                  LLLMethod method = LM_WRAPPER, FloatType float_type = FT_DEFAULT,
+                  int precision = 0, int flags = LLL_DEFAULT, LLLStats *stats = nullptr);
+
+/**
+ * @brief bkz_reduction (see bkz.h) with `context` attached to the calling thread.
+ */
+int bkz_reduction(ReductionContext &context, ZZ_mat<mpz_t> &b, const BKZParam &param,
+                  FloatType float_type = FT_DEFAULT, int precision = 0);
+
+int bkz_reduction(ReductionContext &context, ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u,
+                  const BKZParam &param, FloatType float_type = FT_DEFAULT, int precision = 0);
+
+/**
+ * @brief shortest_vector (see svpcvp.h) with `context` attached to the calling thread.
+ */
+int shortest_vector(ReductionContext &context, ZZ_mat<mpz_t> &b, vector<Z_NR<mpz_t>> &sol_coord,
+                    SVPMethod method = SVPM_PROVED, int flags = SVP_DEFAULT);
+
+FPLLL_END_NAMESPACE
+
+#endif
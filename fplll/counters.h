@@ -0,0 +1,132 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef FPLLL_COUNTERS_H
+#define FPLLL_COUNTERS_H
+
+#include <cstdint>
+#include <fplll/defs.h>
+
+FPLLL_BEGIN_NAMESPACE
+
+/**
+ * @brief Operations performed through a MatGSOInterface.
+ *
+ * The counters are plain increments on the object and are always enabled.
+ */
+struct GSOCounters
+{
+  GSOCounters()
+      : row_add(0), row_addmul_si(0), row_addmul_2exp(0), row_addmul_we(0), gso_row_updates(0)
+  {
+  }
+
+  /** row_add and row_sub **/
+  uint64_t row_add;
+  /** row_addmul_si **/
+  uint64_t row_addmul_si;
+  /** row_addmul_si_2exp and row_addmul_2exp **/
+  uint64_t row_addmul_2exp;
+  /** calls to row_addmul_we, each of which is also counted as one of the operations above
+      (unless the multiplier rounds to zero) **/
+  uint64_t row_addmul_we;
+  /** calls to update_gso_row which recomputed at least one coefficient **/
+  uint64_t gso_row_updates;
+
+  GSOCounters &operator+=(const GSOCounters &c)
+  {
+    row_add += c.row_add;
+    row_addmul_si += c.row_addmul_si;
+    row_addmul_2exp += c.row_addmul_2exp;
+    row_addmul_we += c.row_addmul_we;
+    gso_row_updates += c.gso_row_updates;
+    return *this;
+  }
+
+  GSOCounters &operator-=(const GSOCounters &c)
+  {
+    row_add -= c.row_add;
+    row_addmul_si -= c.row_addmul_si;
+    row_addmul_2exp -= c.row_addmul_2exp;
+    row_addmul_we -= c.row_addmul_we;
+    gso_row_updates -= c.gso_row_updates;
+    return *this;
+  }
+};
+
+/**
+ * @brief Counters of an LLL reduction.
+ *
+ * Filled by LLLReduction::get_stats() for a single reduction object and aggregated over all the
+ * reductions the wrapper tried when passed to lll_reduction(). Times are wall-clock seconds spent
+ * in LLLReduction::lll(), per method.
+ */
+struct LLLStats
+{
+  LLLStats()
+      : swaps(0), size_reduction_iterations(0), babai_restarts(0), lll_calls(0),
+        precision_escalations(0), fast_time(0.0), heuristic_time(0.0), proved_time(0.0)
+  {
+  }
+
+  /** number of failed Lovasz tests, i.e. of vectors moved down **/
+  uint64_t swaps;
+  /** passes of the size-reduction (Babai) loop which performed row operations **/
+  uint64_t size_reduction_iterations;
+  /** passes of the Babai loop which performed row operations on a vector already size-reduced
+      once in the same call, because the first pass was not accurate enough **/
+  uint64_t babai_restarts;
+  /** row operations and GSO row recomputations **/
+  GSOCounters gso;
+  /** number of calls to LLLReduction::lll() **/
+  uint64_t lll_calls;
+  /** number of times the wrapper switched to a more precise method after a failure **/
+  uint64_t precision_escalations;
+  /** time spent in LM_FAST, LM_HEURISTIC and LM_PROVED reductions **/
+  double fast_time;
+  double heuristic_time;
+  double proved_time;
+
+  LLLStats &operator+=(const LLLStats &s)
+  {
+    swaps += s.swaps;
+    size_reduction_iterations += s.size_reduction_iterations;
+    babai_restarts += s.babai_restarts;
+    gso += s.gso;
+    lll_calls += s.lll_calls;
+    precision_escalations += s.precision_escalations;
+    fast_time += s.fast_time;
+    heuristic_time += s.heuristic_time;
+    proved_time += s.proved_time;
+    return *this;
+  }
+
+  /** add `seconds` to the time of `method` **/
+  void add_time(LLLMethod method, double seconds)
+  {
+    if (method == LM_FAST)
+      fast_time += seconds;
+    else if (method == LM_HEURISTIC)
+      heuristic_time += seconds;
+    else if (method == LM_PROVED)
+      proved_time += seconds;
+  }
+
+  double total_time() const { return fast_time + heuristic_time + proved_time; }
+};
+
+FPLLL_END_NAMESPACE
+
+#endif
@@ -0,0 +1,266 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "decompose.h"
+#include "context.h"
+#include "progress.h"
+#include "threadpool.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+FPLLL_BEGIN_NAMESPACE
+
+static int find_root(vector<int> &parent, int i)
+{
+  while (parent[i] != i)
+  {
+    parent[i] = parent[parent[i]];
+    i         = parent[i];
+  }
+  return i;
+}
+
+template <class ZT> vector<vector<int>> orthogonal_components(ZZ_mat<ZT> &b)
+{
+  int d = b.get_rows();
+  int n = b.get_cols();
+
+  // nonzero columns of each row, the inner products only run over the common ones
+  vector<vector<int>> support(d);
+  for (int i = 0; i < d; i++)
+  {
+    for (int j = 0; j < n; j++)
+    {
+      if (!b(i, j).is_zero())
+        support[i].push_back(j);
+    }
+  }
+
+  // union-find over the rows, pairs already in the same component are skipped, so a dense basis
+  // only costs d inner products
+  vector<int> parent(d);
+  for (int i = 0; i < d; i++)
+    parent[i] = i;
+  Z_NR<ZT> dot;
+  for (int i = 0; i < d; i++)
+  {
+    if (support[i].empty())
+      continue;
+    for (int j = i + 1; j < d; j++)
+    {
+      if (support[j].empty() || find_root(parent, i) == find_root(parent, j))
+        continue;
+      dot = 0;
+      auto si = support[i].begin(), sj = support[j].begin();
+      while (si != support[i].end() && sj != support[j].end())
+      {
+        if (*si < *sj)
+          ++si;
+        else if (*sj < *si)
+          ++sj;
+        else
+        {
+          dot.addmul(b(i, *si), b(j, *sj));
+          ++si;
+          ++sj;
+        }
+      }
+      if (!dot.is_zero())
+        parent[find_root(parent, j)] = find_root(parent, i);
+    }
+  }
+
+  vector<vector<int>> components;
+  vector<int> index(d, -1);
+  for (int i = 0; i < d; i++)
+  {
+    if (support[i].empty())
+      continue;
+    int root = find_root(parent, i);
+    if (index[root] < 0)
+    {
+      index[root] = components.size();
+      components.push_back(vector<int>());
+    }
+    components[index[root]].push_back(i);
+  }
+  return components;
+}
+
+template <class ZT>
+int reduce_components(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv_t,
+                      const std::function<int(ZZ_mat<ZT> &, ZZ_mat<ZT> &, ZZ_mat<ZT> &)> &reduce)
+{
+  vector<vector<int>> components = orthogonal_components(b);
+  int n_components               = components.size();
+  if (n_components <= 1)
+    return RED_SUCCESS;
+
+  int d = b.get_rows();
+  int n = b.get_cols();
+
+  // copy each component to the columns it uses
+  vector<vector<int>> columns(n_components);
+  vector<ZZ_mat<ZT>> bc(n_components), uc(n_components), uc_inv_t(n_components);
+  vector<char> used(n);
+  for (int k = 0; k < n_components; k++)
+  {
+    const vector<int> &rows = components[k];
+    std::fill(used.begin(), used.end(), 0);
+    for (int i : rows)
+    {
+      for (int j = 0; j < n; j++)
+        used[j] |= !b(i, j).is_zero();
+    }
+    for (int j = 0; j < n; j++)
+    {
+      if (used[j])
+        columns[k].push_back(j);
+    }
+    bc[k].resize(rows.size(), columns[k].size());
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+      for (size_t j = 0; j < columns[k].size(); j++)
+        bc[k](i, j) = b(rows[i], columns[k][j]);
+    }
+    if (!u.empty())
+      uc[k].gen_identity(rows.size());
+    if (!u_inv_t.empty())
+      uc_inv_t[k].gen_identity(rows.size());
+  }
+
+  // the contexts are set up by the calling thread, so that they inherit its external enumerator
+  // and its precision and draw their seeds in a fixed order
+  vector<std::unique_ptr<ReductionContext>> contexts(n_components);
+  for (int k = 0; k < n_components; k++)
+  {
+    contexts[k].reset(new ReductionContext(gmp_urandomb_ui(RandGen::get_gmp_state(), 32)));
+    contexts[k]->precision = FP_NR<mpfr_t>::get_prec();
+  }
+
+  vector<int> order(n_components);
+  for (int k = 0; k < n_components; k++)
+    order[k] = k;
+  std::stable_sort(order.begin(), order.end(), [&](int k1, int k2) {
+    return components[k1].size() > components[k2].size();
+  });
+
+  vector<int> status(n_components, RED_SUCCESS);
+  std::atomic<int> next(0);
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  ReductionControl *control = get_reduction_control();
+  auto job                  = [&]() {
+    ReductionControlScope control_scope(control);
+    try
+    {
+      for (int j = next++; j < n_components; j = next++)
+      {
+        int k = order[j];
+        ReductionContextScope context_scope(contexts[k].get());
+        status[k] = reduce(bc[k], uc[k], uc_inv_t[k]);
+      }
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      error = std::current_exception();
+    }
+  };
+  int n_jobs = std::min(get_threads(), n_components);
+  if (n_jobs <= 1)
+    job();
+  else
+  {
+    thread_pool::thread_pool &pool = get_threadpool();
+    for (int j = 0; j < n_jobs; ++j)
+      pool.push(job);
+    pool.wait_work();
+  }
+  if (error)
+    std::rethrow_exception(error);
+
+  // reassemble, the zero rows first
+  ZZ_mat<ZT> new_b(d, n), new_u, new_u_inv_t;
+  if (!u.empty())
+    new_u.resize(d, u.get_cols());
+  if (!u_inv_t.empty())
+    new_u_inv_t.resize(d, u_inv_t.get_cols());
+  vector<char> in_component(d, 0);
+  for (int k = 0; k < n_components; k++)
+  {
+    for (int i : components[k])
+      in_component[i] = 1;
+  }
+  int r = 0;
+  for (int i = 0; i < d; i++)
+  {
+    if (in_component[i])
+      continue;
+    if (!u.empty())
+      new_u[r].add(u[i]);
+    if (!u_inv_t.empty())
+      new_u_inv_t[r].add(u_inv_t[i]);
+    r++;
+  }
+  for (int k = 0; k < n_components; k++)
+  {
+    const vector<int> &rows = components[k];
+    for (size_t i = 0; i < rows.size(); i++, r++)
+    {
+      for (size_t j = 0; j < columns[k].size(); j++)
+        new_b(r, columns[k][j]) = bc[k](i, j);
+      for (size_t l = 0; l < rows.size(); l++)
+      {
+        if (!u.empty() && !uc[k](i, l).is_zero())
+          new_u[r].addmul(u[rows[l]], uc[k](i, l));
+        if (!u_inv_t.empty() && !uc_inv_t[k](i, l).is_zero())
+          new_u_inv_t[r].addmul(u_inv_t[rows[l]], uc_inv_t[k](i, l));
+      }
+    }
+  }
+  b.swap(new_b);
+  u.swap(new_u);
+  u_inv_t.swap(new_u_inv_t);
+
+  for (int k = 0; k < n_components; k++)
+  {
+    if (status[k] != RED_SUCCESS)
+      return status[k];
+  }
+  return RED_SUCCESS;
+}
+
+template vector<vector<int>> orthogonal_components<mpz_t>(ZZ_mat<mpz_t> &);
+template int reduce_components<mpz_t>(
+    ZZ_mat<mpz_t> &, ZZ_mat<mpz_t> &, ZZ_mat<mpz_t> &,
+    const std::function<int(ZZ_mat<mpz_t> &, ZZ_mat<mpz_t> &, ZZ_mat<mpz_t> &)> &);
+
+#ifdef FPLLL_WITH_ZLONG
+template vector<vector<int>> orthogonal_components<long>(ZZ_mat<long> &);
+template int
+reduce_components<long>(ZZ_mat<long> &, ZZ_mat<long> &, ZZ_mat<long> &,
+                        const std::function<int(ZZ_mat<long> &, ZZ_mat<long> &, ZZ_mat<long> &)> &);
+#endif
+
+#ifdef FPLLL_WITH_ZDOUBLE
+template vector<vector<int>> orthogonal_components<double>(ZZ_mat<double> &);
+template int reduce_components<double>(
+    ZZ_mat<double> &, ZZ_mat<double> &, ZZ_mat<double> &,
+    const std::function<int(ZZ_mat<double> &, ZZ_mat<double> &, ZZ_mat<double> &)> &);
+#endif
+
+FPLLL_END_NAMESPACE
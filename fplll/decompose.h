@@ -0,0 +1,63 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef FPLLL_DECOMPOSE_H
+#define FPLLL_DECOMPOSE_H
+
+#include "nr/matrix.h"
+#include <functional>
+
+FPLLL_BEGIN_NAMESPACE
+
+/**
+ * @brief Splits the nonzero rows of b into orthogonal components.
+ *
+ * Two rows are in the same component if they are connected by a chain of rows with nonzero
+ * inner products, that is the components are the connected components of the zero pattern of the
+ * Gram matrix. The lattice spanned by b is the orthogonal sum of the lattices spanned by the
+ * components, whatever the order of the rows (e.g. a block-diagonal basis whose rows were
+ * permuted). The components are listed in the order of their first row, each in increasing order.
+ * The zero rows belong to no component.
+ */
+template <class ZT> vector<vector<int>> orthogonal_components(ZZ_mat<ZT> &b);
+
+/**
+ * @brief Reduces each orthogonal component of b independently.
+ *
+ * If b has at least two orthogonal components (see orthogonal_components), each component is
+ * copied to a smaller basis keeping only the columns in which it has nonzero entries, and
+ * reduced with `reduce(bc, uc, uc_inv_t)`, where uc and uc_inv_t are the identity if u and
+ * u_inv_t are not empty and empty otherwise. The components are reduced concurrently by the
+ * threads of the threadpool (see set_threads), the largest ones first. Each reduction runs with
+ * its own ReductionContext, with a single thread and a seed drawn from the random generator of the
+ * caller, so the result does not depend on the number of threads. The control attached to the
+ * calling thread (see ReductionControl) is attached to the reductions.
+ *
+ * The reduced components then replace the rows of b, the zero rows first and then the components
+ * in the order of orthogonal_components. The transformations of the components are applied to u
+ * and u_inv_t (which is transposed, as in lll_reduction_z). Vectors of distinct components are
+ * orthogonal, so b is reduced once the Lovász conditions between the components hold, which a
+ * final reduction of the whole basis achieves with swaps only.
+ *
+ * @return RED_SUCCESS if b has at most one component (b is left unchanged) or if all the
+ *         reductions succeeded, otherwise the status of the first component which failed
+ */
+template <class ZT>
+int reduce_components(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv_t,
+                      const std::function<int(ZZ_mat<ZT> &, ZZ_mat<ZT> &, ZZ_mat<ZT> &)> &reduce);
+
+FPLLL_END_NAMESPACE
+
+#endif
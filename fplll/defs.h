@@ -164,7 +164,9 @@ enum RedStatus
   RED_HLLL_FAILURE      = 9,
   RED_HLLL_NORM_FAILURE = 10,
   RED_HLLL_SR_FAILURE   = 11,
-  RED_STATUS_MAX        = 12
+  RED_CANCELLED         = 12,
+  RED_TARGET_REACHED    = 13,
+  RED_STATUS_MAX        = 14
 };
 
 const char *const RED_STATUS_STR[RED_STATUS_MAX] = {"success",
@@ -178,7 +180,9 @@ const char *const RED_STATUS_STR[RED_STATUS_MAX] = {"success",
                                                     "loops limit exceeded in BKZ",
                                                     "error in HLLL",
                                                     "increase of the norm",
-                                                    "error in weak size reduction"};
+                                                    "error in weak size reduction",
+                                                    "cancelled",
+                                                    "target norm reached"};
 
 enum LLLMethod
 {
@@ -194,6 +198,14 @@ const char *const LLL_METHOD_STR[6] = {"wrapper", "proved", "heuristic", "fast"}
 // we leave empty the third string.
 const char *const HLLL_METHOD_STR[4] = {"wrapper", "proved", "", "fast"};
 
+enum BKZMethod
+{
+  BKZ_METHOD_GSO         = 0,
+  BKZ_METHOD_HOUSEHOLDER = 1
+};
+
+const char *const BKZ_METHOD_STR[2] = {"gso", "householder"};
+
 enum IntType
 {
   ZT_MPZ    = 0,
@@ -218,10 +230,15 @@ const char *const FLOAT_TYPE_STR[7] = {"", "double", "long double", "dpe", "dd",
 
 enum LLLFlags
 {
-  LLL_VERBOSE   = 1,
-  LLL_EARLY_RED = 2,
-  LLL_SIEGEL    = 4,
-  LLL_DEFAULT   = 0
+  LLL_VERBOSE      = 1,
+  LLL_EARLY_RED    = 2,
+  LLL_SIEGEL       = 4,
+  LLL_GSO_WINDOW   = 8,
+  LLL_PREDICT_PREC = 16,
+  LLL_NO_TARGET    = 32,
+  LLL_QARY         = 64,
+  LLL_DECOMPOSE    = 128,
+  LLL_DEFAULT      = 0
 };
 
 enum SVPMethod
@@ -258,17 +275,22 @@ const int BKZ_DEF_RERANDOMIZATION_DENSITY    = 3;
 
 enum BKZFlags
 {
-  BKZ_DEFAULT     = 0,
-  BKZ_VERBOSE     = 1,
-  BKZ_NO_LLL      = 2,
-  BKZ_MAX_LOOPS   = 4,
-  BKZ_MAX_TIME    = 8,
-  BKZ_BOUNDED_LLL = 0x10,
-  BKZ_AUTO_ABORT  = 0x20,
-  BKZ_DUMP_GSO    = 0x40,
-  BKZ_GH_BND      = 0x80,
-  BKZ_SD_VARIANT  = 0x100,
-  BKZ_SLD_RED     = 0x200
+  BKZ_DEFAULT       = 0,
+  BKZ_VERBOSE       = 1,
+  BKZ_NO_LLL        = 2,
+  BKZ_MAX_LOOPS     = 4,
+  BKZ_MAX_TIME      = 8,
+  BKZ_BOUNDED_LLL   = 0x10,
+  BKZ_AUTO_ABORT    = 0x20,
+  BKZ_DUMP_GSO      = 0x40,
+  BKZ_GH_BND        = 0x80,
+  BKZ_SD_VARIANT    = 0x100,
+  BKZ_SLD_RED       = 0x200,
+  BKZ_PARALLEL      = 0x400,
+  BKZ_LOCAL_PREPROC = 0x800,
+  BKZ_ROTATIONS     = 0x1000,
+  BKZ_QARY          = 0x2000,
+  BKZ_DECOMPOSE     = 0x4000
 };
 
 enum HKZFlags
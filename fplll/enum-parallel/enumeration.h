@@ -27,6 +27,7 @@ SOFTWARE.
 
 #include "fplll_types.h"
 #include <fplll/threadpool.h>
+#include <fplll/trace.h>
 
 #include <algorithm>
 #include <array>
@@ -80,8 +81,6 @@ template <int N> struct globals_t
   vector<vector<swirl_item_t>> swirlys;
 };
 
-extern mutex_type global_mutex;
-
 template <int N, int SWIRLY, int SWIRLY2BUF, int SWIRLY1FRACTION, bool findsubsols = false>
 struct lattice_enum_t
 {
@@ -461,6 +460,10 @@ struct lattice_enum_t
       std::atomic<std::size_t> swirly_i(0);
       unsigned threadid = 0;
       auto f            = [this, &swirly_ref, &swirly_i, swirly1end, &threadid]() {
+        FPLLL_TRACE_ZONE("enumlib::worker");
+        const int start_cpu = ::fplll::affinity_job_begin();
+        // the copy is first touched by this thread: with pinned threads (see set_thread_affinity)
+        // the per-thread enumeration state is allocated on the local NUMA node
         auto mylat = *this;
         {
           lock_type lock(globals.mutex);
@@ -496,10 +499,20 @@ struct lattice_enum_t
             this->_subsolL[j] = mylat._subsolL[j];
             this->_subsol[j]  = mylat._subsol[j];
           }
+        ::fplll::affinity_job_end(start_cpu);
       };
-      for (int i = 0; i < ::fplll::get_threads(); ++i)
-        threadpool.push(f);
-      threadpool.wait_work();
+      const int jobs = ::fplll::get_enumeration_threads();
+      if (jobs == 1)
+      {
+        f();
+      }
+      else
+      {
+        thread_pool::thread_pool &pool = ::fplll::get_threadpool();
+        for (int i = 0; i < jobs; ++i)
+          pool.push(f);
+        pool.wait_work();
+      }
 
       swirlys[1].erase(swirlys[1].begin(), swirlys[1].begin() + swirly1end);
     }
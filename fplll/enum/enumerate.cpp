@@ -17,6 +17,8 @@
    along with fplll. If not, see <http://www.gnu.org/licenses/>. */
 
 #include "enumerate.h"
+#include <fplll/trace.h>
+#include <random>
 
 FPLLL_BEGIN_NAMESPACE
 
@@ -61,6 +63,7 @@ void EnumerationDyn<ZT, FT>::enumerate(int first, int last, FT &fmaxdist, long f
                                        const vector<enumxt> &subtree, const vector<enumf> &pruning,
                                        bool _dual, bool subtree_reset)
 {
+  FPLLL_TRACE_ZONE("EnumerationDyn::enumerate");
   bool solvingsvp = target_coord.empty();
   dual            = _dual;
   pruning_bounds  = pruning;
@@ -88,6 +91,30 @@ void EnumerationDyn<ZT, FT>::enumerate(int first, int last, FT &fmaxdist, long f
       center_partsum[i] = target_coord[i + first].get_d();
   }
 
+  long normexp = load_gso(first, fmaxdist, fmaxdistexpo);
+  _evaluator.set_normexp(normexp);
+
+  subsoldists = rdiag;
+
+  save_rounding();
+  prepare_enumeration(subtree, solvingsvp, subtree_reset);
+  do_enumerate();
+  restore_rounding();
+
+  FT fmaxdistnorm = maxdist;  // Exact
+
+  fmaxdist.mul_2si(fmaxdistnorm, normexp - fmaxdistexpo);
+
+  if (dual && !_evaluator.empty())
+  {
+    for (auto it = _evaluator.begin(), itend = _evaluator.end(); it != itend; ++it)
+      reverse_by_swap(it->second, 0, d - 1);
+  }
+}
+
+template <typename ZT, typename FT>
+long EnumerationDyn<ZT, FT>::load_gso(int first, const FT &fmaxdist, long fmaxdistexpo)
+{
   FT fr, fmu, fmaxdistnorm;
   long rexpo, normexp = -1;
   for (int i = 0; i < d; ++i)
@@ -103,7 +130,6 @@ void EnumerationDyn<ZT, FT>::enumerate(int first, int last, FT &fmaxdist, long f
   }
   fmaxdistnorm.mul_2si(fmaxdist, fmaxdistexpo - normexp);
   maxdist = fmaxdistnorm.get_d(GMP_RNDU);
-  _evaluator.set_normexp(normexp);
 
   if (dual)
   {
@@ -139,23 +165,77 @@ void EnumerationDyn<ZT, FT>::enumerate(int first, int last, FT &fmaxdist, long f
       }
     }
   }
+  return normexp;
+}
 
-  subsoldists = rdiag;
-
-  save_rounding();
-  prepare_enumeration(subtree, solvingsvp, subtree_reset);
-  do_enumerate();
-  restore_rounding();
+template <typename ZT, typename FT>
+EnumerationEstimate EnumerationDyn<ZT, FT>::estimate_nodes(int first, int last, const FT &fmaxdist,
+                                                           long fmaxdistexpo,
+                                                           const vector<enumf> &pruning,
+                                                           bool _dual, int descents, uint64_t seed)
+{
+  dual           = _dual;
+  pruning_bounds = pruning;
+  if (last == -1)
+    last = _gso.d;
+  d = last - first;
+  FPLLL_CHECK(d < maxdim, "estimate_nodes: dimension is too high");
+  FPLLL_CHECK(descents > 0, "estimate_nodes: at least one descent is needed");
+  load_gso(first, fmaxdist, fmaxdistexpo);
+  set_bounds();
 
-  fmaxdistnorm = maxdist;  // Exact
+  EnumerationEstimate estimate;
+  estimate.descents = descents;
+  estimate.level_nodes.assign(d, 0.0);
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  double sum = 0.0, sum2 = 0.0;
 
-  fmaxdist.mul_2si(fmaxdistnorm, normexp - fmaxdistexpo);
-
-  if (dual && !_evaluator.empty())
+  for (int t = 0; t < descents; ++t)
   {
-    for (auto it = _evaluator.begin(), itend = _evaluator.end(); it != itend; ++it)
-      reverse_by_swap(it->second, 0, d - 1);
+    // weight = number of nodes at the current level estimated from the path so far
+    double weight = 1.0, path_nodes = 0.0;
+    enumf newdist = 0.0;
+    bool zero     = true;  // all the coordinates chosen so far are zero
+    for (int kk = d - 1; kk >= 0; --kk)
+    {
+      enumf newcenter = 0.0;
+      if (!zero)
+      {
+        for (int j = kk + 1; j < d; ++j)
+          newcenter -= (dual ? alpha[j] : x[j]) * mut[kk][j];
+      }
+      enumf width2 = (partdistbounds[kk] - newdist) / rdiag[kk];
+      if (!(width2 >= 0.0))
+        break;
+      enumf width = std::sqrt(width2);
+      double lo = std::ceil(newcenter - width), hi = std::floor(newcenter + width);
+      // as long as the partial distance is zero, the enumeration only visits x >= 0 (and x > 0
+      // at the last level)
+      if (zero)
+        lo = max(lo, kk == 0 ? 1.0 : 0.0);
+      if (hi < lo)
+        break;
+
+      weight *= hi - lo + 1.0;
+      path_nodes += weight;
+      estimate.level_nodes[kk] += weight;
+
+      x[kk]     = min(hi, lo + std::floor(uniform(rng) * (hi - lo + 1.0)));
+      alpha[kk] = x[kk] - newcenter;
+      newdist += alpha[kk] * alpha[kk] * rdiag[kk];
+      zero = zero && x[kk] == 0;
+    }
+    sum += path_nodes;
+    sum2 += path_nodes * path_nodes;
   }
+
+  estimate.nodes  = sum / descents;
+  double variance = max(0.0, sum2 / descents - estimate.nodes * estimate.nodes);
+  estimate.error  = std::sqrt(variance / descents);
+  for (int i = 0; i < d; ++i)
+    estimate.level_nodes[i] /= descents;
+  return estimate;
 }
 
 template <typename ZT, typename FT>
@@ -250,7 +330,10 @@ void EnumerationDyn<ZT, FT>::process_subsolution(int offset, enumf newdist)
 
 template <typename ZT, typename FT> void EnumerationDyn<ZT, FT>::do_enumerate()
 {
-  nodes = 0;
+  nodes            = 0;
+  reported_nodes   = 0;
+  control          = get_reduction_control();
+  control_interval = control ? ENUM_CONTROL_INTERVAL : INT64_MAX;
 
   set_bounds();
 
@@ -266,6 +349,9 @@ template <typename ZT, typename FT> void EnumerationDyn<ZT, FT>::do_enumerate()
     enumerate_loop<false, true, true>();
   else if (!dual && !_evaluator.findsubsols && resetflag)
     enumerate_loop<false, false, true>();
+
+  if (control)
+    control->report_nodes(nodes - reported_nodes);
 }
 
 template class Enumeration<Z_NR<mpz_t>, FP_NR<double>>;
@@ -28,6 +28,23 @@
 
 FPLLL_BEGIN_NAMESPACE
 
+/**
+ * @brief Estimate of the size of an enumeration tree (see EnumerationDyn::estimate_nodes).
+ */
+struct EnumerationEstimate
+{
+  EnumerationEstimate() : nodes(0.0), error(0.0), descents(0) {}
+
+  /** estimated number of nodes **/
+  double nodes;
+  /** standard error of the estimate **/
+  double error;
+  /** estimated number of nodes at each level, level 0 being the leaves **/
+  vector<double> level_nodes;
+  /** number of random descents the estimate is based on **/
+  int descents;
+};
+
 template <typename ZT, typename FT> class EnumerationDyn : public EnumerationBase
 {
 public:
@@ -44,6 +61,28 @@ public:
                  const vector<enumf> &pruning = vector<enumf>(), bool dual = false,
                  bool subtree_reset = false);
 
+  /**
+     @brief Estimate the number of nodes of an SVP enumeration without running it.
+
+     Runs `descents` random root-to-leaf descents in the tree explored by enumerate() with the same
+     arguments and returns Knuth's unbiased estimate of its size: at each level, the number of
+     children of the current node is computed and one of them is chosen uniformly at random.
+     The radius is not decreased when a solution is found, so the number of nodes visited by an
+     enumeration which updates its radius is usually smaller.
+
+     @param first    first row of the block
+     @param last     end row (exclusive) of the block, -1 for the last row
+     @param fmaxdist squared radius (times 2^fmaxdistexpo)
+     @param fmaxdistexpo exponent of the radius
+     @param pruning  pruning coefficients, empty for no pruning
+     @param dual     estimate the dual enumeration
+     @param descents number of random descents
+     @param seed     seed of the random choices
+  */
+  EnumerationEstimate estimate_nodes(int first, int last, const FT &fmaxdist, long fmaxdistexpo,
+                                     const vector<enumf> &pruning = vector<enumf>(),
+                                     bool dual = false, int descents = 1000, uint64_t seed = 0);
+
   inline uint64_t get_nodes() const { return nodes; }
 
 private:
@@ -55,6 +94,10 @@ private:
   enumf maxdist;
   vector<FT> fx;
 
+  /* loads the normalized GSO of the block in rdiag and mut and the normalized radius in maxdist,
+     returns the normalization exponent */
+  long load_gso(int first, const FT &fmaxdist, long fmaxdistexpo);
+
   void prepare_enumeration(const vector<enumxt> &subtree, bool solvingsvp, bool subtree_reset);
 
   void do_enumerate();
@@ -80,7 +123,14 @@ public:
                  const vector<enumf> &pruning = vector<enumf>(), bool dual = false,
                  bool subtree_reset = false)
   {
+    ReductionControl *control = get_reduction_control();
+    if (control && control->is_cancelled())
+    {
+      _nodes = 0;
+      return;
+    }
     // check for external enumerator and use that
+    // (it cannot be interrupted, its nodes are reported once it is done)
     if (get_external_enumerator() != nullptr && subtree.empty() && target_coord.empty())
     {
       if (enumext.get() == nullptr)
@@ -88,6 +138,8 @@ public:
       if (enumext->enumerate(first, last, fmaxdist, fmaxdistexpo, pruning, dual))
       {
         _nodes = enumext->get_nodes();
+        if (control)
+          control->report_nodes(_nodes);
         return;
       }
     }
@@ -100,6 +152,22 @@ public:
     _nodes = enumdyn->get_nodes();
   }
 
+  /**
+     @brief Estimate the number of nodes of enumerate() (see EnumerationDyn::estimate_nodes).
+
+     The estimate is computed on fplll's own enumeration tree, also when enumerate() would use
+     the external enumerator.
+  */
+  EnumerationEstimate estimate_nodes(int first, int last, const FT &fmaxdist, long fmaxdistexpo,
+                                     const vector<enumf> &pruning = vector<enumf>(),
+                                     bool dual = false, int descents = 1000, uint64_t seed = 0)
+  {
+    if (enumdyn.get() == nullptr)
+      enumdyn.reset(new EnumerationDyn<ZT, FT>(_gso, _evaluator, _max_indices));
+    return enumdyn->estimate_nodes(first, last, fmaxdist, fmaxdistexpo, pruning, dual, descents,
+                                   seed);
+  }
+
   inline uint64_t get_nodes() const { return _nodes; }
 
 private:
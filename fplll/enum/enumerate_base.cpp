@@ -31,6 +31,8 @@ inline void EnumerationBase::enumerate_recursive(
   if (!(newdist <= partdistbounds[kk]))
     return;
   ++nodes;
+  if (static_cast<int64_t>(nodes - reported_nodes) >= control_interval && check_control())
+    return;
 
   alpha[kk] = alphak;
   if (findsubsols && newdist < subsoldists[kk] && newdist != 0.0)
@@ -176,6 +178,16 @@ inline void EnumerationBase::enumerate_recursive_dispatch(int kk)
 
 #endif
 
+bool EnumerationBase::check_control()
+{
+  control->report_nodes(nodes - reported_nodes);
+  reported_nodes = nodes;
+  if (!control->is_cancelled())
+    return false;
+  fill(partdistbounds.begin(), partdistbounds.end(), -1.0);
+  return true;
+}
+
 template <bool dualenum, bool findsubsols, bool enable_reset> void EnumerationBase::enumerate_loop()
 {
   if (k >= k_end)
@@ -208,6 +220,8 @@ template <bool dualenum, bool findsubsols, bool enable_reset> void EnumerationBa
     if (newdist <= partdistbounds[k])
     {
       ++nodes;
+      if (static_cast<int64_t>(nodes - reported_nodes) >= control_interval && check_control())
+        break;
       alpha[k] = alphak;
       if (findsubsols && newdist < subsoldists[k] && newdist != 0.0)
       {
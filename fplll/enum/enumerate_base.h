@@ -21,6 +21,7 @@
 
 #include "fplll/fplll_config.h"
 #include "fplll/nr/nr.h"
+#include "fplll/progress.h"
 #include <array>
 #include <cfenv>
 #include <cmath>
@@ -51,11 +52,15 @@ inline void roundto(double &dest, const double &src) { dest = round(src); }
 #define ENUM_ALWAYS_INLINE ALWAYS_INLINE
 #endif
 
+/* number of nodes between two checks of the ReductionControl (see progress.h) */
+const int64_t ENUM_CONTROL_INTERVAL = 1 << 16;
+
 class EnumerationBase
 {
 public:
   static const int maxdim = FPLLL_MAX_ENUM_DIM;
 
+  EnumerationBase() : control(nullptr), reported_nodes(0), control_interval(INT64_MAX) {}
   inline uint64_t get_nodes() const { return nodes; }
   virtual ~EnumerationBase() {}
 
@@ -90,6 +95,17 @@ protected:
   /* nodes count */
   uint64_t nodes;
 
+  /* progress reporting and cancellation, control_interval is INT64_MAX without a control.
+     nodes is temporarily decreased at the start of enumerate_loop(), hence the signed
+     difference nodes - reported_nodes is compared to control_interval */
+  ReductionControl *control;
+  uint64_t reported_nodes;
+  int64_t control_interval;
+
+  /* reports the nodes visited since the last call, returns true and sets all bounds to -1 (so that
+     the enumeration unwinds) if the reduction was cancelled */
+  bool check_control();
+
   template <int kk, int kk_start, bool dualenum, bool findsubsols, bool enable_reset> struct opts
   {
   };
@@ -30,19 +30,36 @@ std::function<extenum_fc_enumerate> fplll_extenum = enumlib::enumlib_enumerate;
 std::function<extenum_fc_enumerate> fplll_extenum = nullptr;
 #endif
 
+static thread_local std::function<extenum_fc_enumerate> *local_extenum = nullptr;
+
 void set_external_enumerator(std::function<extenum_fc_enumerate> extenum)
 {
-  fplll_extenum = extenum;
+  if (local_extenum != nullptr)
+    *local_extenum = extenum;
+  else
+    fplll_extenum = extenum;
 }
 
-std::function<extenum_fc_enumerate> get_external_enumerator() { return fplll_extenum; }
+std::function<extenum_fc_enumerate> get_external_enumerator()
+{
+  return local_extenum != nullptr ? *local_extenum : fplll_extenum;
+}
+
+std::function<extenum_fc_enumerate> *
+set_local_external_enumerator(std::function<extenum_fc_enumerate> *extenum)
+{
+  std::function<extenum_fc_enumerate> *old = local_extenum;
+  local_extenum                            = extenum;
+  return old;
+}
 
 template <typename ZT, typename FT>
 bool ExternalEnumeration<ZT, FT>::enumerate(int first, int last, FT &fmaxdist, long fmaxdistexpo,
                                             const vector<enumf> &pruning, bool dual)
 {
   using namespace std::placeholders;
-  if (fplll_extenum == nullptr)
+  std::function<extenum_fc_enumerate> extenum = get_external_enumerator();
+  if (extenum == nullptr)
     return false;
   if (last == -1)
     last = _gso.d;
@@ -70,10 +87,10 @@ bool ExternalEnumeration<ZT, FT>::enumerate(int first, int last, FT &fmaxdist, l
   _evaluator.set_normexp(_normexp);
 
   // clang-format off
-  _nodes = fplll_extenum(_d, _maxdist,
-                         std::bind(&ExternalEnumeration<ZT,FT>::callback_set_config, this, _1, _2, _3, _4, _5),
-                         std::bind(&ExternalEnumeration<ZT,FT>::callback_process_sol, this, _1, _2),
-                         std::bind(&ExternalEnumeration<ZT,FT>::callback_process_subsol, this, _1, _2, _3),
+  _nodes = extenum(_d, _maxdist,
+                   std::bind(&ExternalEnumeration<ZT,FT>::callback_set_config, this, _1, _2, _3, _4, _5),
+                   std::bind(&ExternalEnumeration<ZT,FT>::callback_process_sol, this, _1, _2),
+                   std::bind(&ExternalEnumeration<ZT,FT>::callback_process_subsol, this, _1, _2, _3),
                _dual, _evaluator.findsubsols
                );
   // clang-format on
@@ -99,6 +99,13 @@ typedef uint64_t(extenum_fc_enumerate)(const int dim, enumf maxdist,
 void set_external_enumerator(std::function<extenum_fc_enumerate> extenum = nullptr);
 std::function<extenum_fc_enumerate> get_external_enumerator();
 
+/* external enumerator of the calling thread (nullptr: use the one of the process), set while a
+   ReductionContext is attached to the thread (see context.h). While it is set, the two functions
+   above read and write *extenum instead of the external enumerator of the process. Returns the
+   previous one. */
+std::function<extenum_fc_enumerate> *
+set_local_external_enumerator(std::function<extenum_fc_enumerate> *extenum);
+
 template <typename ZT, typename FT> class ExternalEnumeration
 {
 public:
@@ -73,12 +73,19 @@ void ErrorBoundedEvaluator::init_delta_def(int prec, double rho, bool withRoundi
    - a~,b~,c~,... are approx. values used or computed by the fp algorithm */
 
 bool ErrorBoundedEvaluator::get_max_error_aux(const FP_NR<mpfr_t> &max_dist, bool boundOnExactVal,
-                                              FP_NR<mpfr_t> &maxDE)
+                                              FP_NR<mpfr_t> &maxDE, bool fast)
 {
 
   FPLLL_CHECK(input_error_defined,
               "Evaluator: error evaluation failed because the input error is undefined");
 
+  double maxDE_d;
+  if (fast && get_max_error_aux_d(max_dist, boundOnExactVal, maxDE_d))
+  {
+    maxDE = maxDE_d;
+    return true;
+  }
+
   FP_NR<mpfr_t> ulp, halfULP, K, tmp1, tmp2;
   FP_NR<mpfr_t> rdiagTilde, minRDiag, maxRDiag, muTilde, maxMu, maxMuTildeX;
   FP_NR<mpfr_t> maxC, maxCTilde, maxY, maxYTilde, maxY2Tilde, maxRY2Tilde;
@@ -210,6 +217,86 @@ bool ErrorBoundedEvaluator::get_max_error_aux(const FP_NR<mpfr_t> &max_dist, boo
   return true;
 }
 
+/* Upper and lower bounds on the exact result of an operation rounded to nearest. */
+static inline double round_up(double x) { return std::nextafter(x, HUGE_VAL); }
+static inline double round_down(double x) { return std::nextafter(x, -HUGE_VAL); }
+
+/* Same bound as get_max_error_aux, computed in double. All the quantities are non-negative upper
+   bounds (except minRDiag), so rounding each operation up (with round_up) keeps them upper
+   bounds. The inputs are converted with directed rounding. Returns false if the bound cannot be
+   computed in double, e.g. when some r(i, i) does not fit in a double. */
+bool ErrorBoundedEvaluator::get_max_error_aux_d(const FP_NR<mpfr_t> &max_dist, bool boundOnExactVal,
+                                                double &maxDE)
+{
+  const double halfULP = numeric_limits<double>::epsilon() * 0.5;
+  const double K       = 1.0 + numeric_limits<double>::epsilon();  // >= 1 + halfULP
+  double maxDist       = max_dist.get_d(GMP_RNDU);
+  double rdiagTilde, maxC, maxCTilde, maxDC, maxMu, muTilde, maxMuTildeX;
+  double maxY, maxYTilde, maxDY, maxDY2, maxY2Tilde, maxRY2Tilde, maxDRY2, tmp1;
+  vector<double> maxX(d, 0.0);
+
+  maxDE = 0.0;
+  for (int i = d - 1; i >= 0; i--)
+  {
+    double maxDMu = max_dm_u[i].get_d(GMP_RNDU);
+    double maxDR  = max_dr_diag[i].get_d(GMP_RNDU);
+    rdiagTilde    = r(i, i).get_d();  // = r~_i
+    if (!(rdiagTilde >= numeric_limits<double>::min()) || std::isinf(rdiagTilde))
+      return false;
+    maxC      = 0.0;
+    maxCTilde = 0.0;
+    maxDC     = 0.0;
+
+    for (int j = d - 1; j > i; j--)
+    {
+      muTilde     = fabs(mu(j, i).get_d());                // = |mu~(j,i)|
+      maxMu       = round_up(round_up(muTilde) + maxDMu);  // >= |mu(j,i)|
+      maxC        = round_up(maxC + round_up(maxMu * maxX[j]));
+      maxMuTildeX = round_up(muTilde * maxX[j]);                        // >= mu~(j,i) * x_j
+      maxDC       = round_up(maxDC + round_up(maxDMu * maxX[j]));       // err1
+      maxDC       = round_up(maxDC + round_up(maxMuTildeX * halfULP));  // err2
+      maxMuTildeX = round_up(maxMuTildeX * K);                          // >= mu~(j,i) *~ x_j
+      maxCTilde   = round_up(maxCTilde + round_up(maxMuTildeX * K));
+      maxDC       = round_up(maxDC + round_up(maxCTilde * halfULP));  // err3
+      maxCTilde   = round_up(maxCTilde * K);
+    }
+
+    if (boundOnExactVal)
+    {
+      double minRDiag = round_down(r(i, i).get_d(GMP_RNDD) - maxDR);  // <= r_i
+      if (!(minRDiag > 0.0))
+        return false;
+      maxY      = round_up(std::sqrt(round_up(maxDist / minRDiag)));  // >= |y_i|
+      maxDY     = round_up(round_up(maxY * halfULP) + round_up(maxDC * K));
+      maxYTilde = round_up(maxY + maxDY);             // >= |y~_i|
+      maxX[i]   = std::floor(round_up(maxY + maxC));  // >= |x_i|
+      tmp1      = maxY;
+    }
+    else
+    {
+      tmp1      = round_up(round_up(maxDist * K) / rdiagTilde);  // >= y~_i *~ y~_i
+      maxYTilde = round_up(std::sqrt(round_up(tmp1 * K)));       // >= y~_i
+      maxDY     = round_up(round_up(maxYTilde * halfULP) + maxDC);
+      maxX[i]   = std::floor(round_up(maxCTilde + round_up(maxYTilde * K)));  // >= |x_i|
+      tmp1      = maxYTilde;
+    }
+
+    maxDY2      = round_up(round_up(2.0 * round_up(maxDY * tmp1)) + round_up(maxDY * maxDY));
+    maxY2Tilde  = round_up(maxYTilde * maxYTilde);
+    maxDY2      = round_up(maxDY2 + round_up(maxY2Tilde * halfULP));
+    maxY2Tilde  = round_up(maxY2Tilde * K);
+    maxRY2Tilde = round_up(rdiagTilde * maxY2Tilde);
+    maxDRY2     = round_up(round_up(r(i, i).get_d(GMP_RNDU) + maxDR) * maxDY2);
+    maxDRY2     = round_up(maxDRY2 + round_up(maxY2Tilde * maxDR));
+    maxDRY2     = round_up(maxDRY2 + round_up(maxRY2Tilde * halfULP));
+
+    maxDE = round_up(maxDE + maxDRY2);
+    maxDE = round_up(maxDE * K);
+    maxDE = round_up(maxDE + round_up(maxDist * halfULP));
+  }
+  return std::isfinite(maxDE);
+}
+
 void FastErrorBoundedEvaluator::eval_sol(const vector<FP_NR<mpfr_t>> &new_sol_coord,
                                          const enumf &new_partial_dist, enumf &max_dist)
 {
@@ -347,6 +434,8 @@ FP_NR<mpfr_t> ExactErrorBoundedEvaluator::int_dist2Float(Z_NR<mpz_t> int_dist)
   FP_NR<mpfr_t> fMaxDist, maxDE;
   fMaxDist.set_z(int_dist, GMP_RNDU);
   bool result = get_max_error_aux(fMaxDist, true, maxDE);
+  if (result && maxDE > r(0, 0))
+    result = get_max_error_aux(fMaxDist, true, maxDE, false);
   FPLLL_CHECK(result, "ExactEvaluator: error cannot be bounded");
   FPLLL_CHECK(maxDE <= r(0, 0), "ExactEvaluator: max error is too large");
   fMaxDist.add(fMaxDist, maxDE);
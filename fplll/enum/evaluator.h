@@ -302,7 +302,13 @@ public:
   virtual bool get_max_error(FP_NR<mpfr_t> &max_error, const FP_NR<mpfr_t> &sol_dist) = 0;
 
   // Internal use
-  bool get_max_error_aux(const FP_NR<mpfr_t> &max_dist, bool boundOnExactVal, FP_NR<mpfr_t> &maxDE);
+  /* The bound is first evaluated in double with every operation rounded up (see
+     get_max_error_aux_d) and in FP_NR<mpfr_t> only if this fails or if fast = false. */
+  bool get_max_error_aux(const FP_NR<mpfr_t> &max_dist, bool boundOnExactVal, FP_NR<mpfr_t> &maxDE,
+                         bool fast = true);
+
+private:
+  bool get_max_error_aux_d(const FP_NR<mpfr_t> &max_dist, bool boundOnExactVal, double &maxDE);
 };
 
 /**
@@ -22,24 +22,77 @@ Enumerator::Enumerator(int d, const Matrix<FP_NR<mpfr_t>> &mu, const Matrix<FP_N
     : mu(mu), r(r), kmin(min_level), d(d)
 {
   max_volume = argMaxVolume > 0 ? argMaxVolume : ENUM_MAX_VOLUME;
-  gen_zero_vect(center, d);
-  gen_zero_vect(dist, d);
-  gen_zero_vect(x, d);
-  gen_zero_vect(dx, d);
-  gen_zero_vect(ddx, d);
+  mu_d.resize(d);
+  r_d.resize(d);
+  log_r.resize(d);
+  log_ball.resize(d + 1);
+  for (int i = 0; i < d; i++)
+  {
+    mu_d[i].resize(i);
+    for (int j = 0; j < i; j++)
+      mu_d[i][j] = mu(i, j).get_d();
+    r_d[i]   = r(i, i).get_d();
+    log_r[i] = std::log(r_d[i]);
+  }
+  for (int i = 0; i <= d; i++)
+    log_ball[i] = 0.5 * i * std::log(M_PI) - std::lgamma(0.5 * i + 1.0);
+  center.assign(d, 0.0);
+  center_err.assign(d, 0.0);
+  dist.assign(d, 0.0);
+  dist_err.assign(d, 0.0);
+  x.assign(d, 0.0);
+  dx.assign(d, 0.0);
+  ddx.assign(d, 0.0);
   svp_init_needed = true;
 }
 
+double Enumerator::cost_estimate_d(double bound, int dim_max)
+{
+  if (bound <= 0.0)
+    return 0.0;
+  double log_bound = std::log(bound), log_det = 0.0, cost = 0.0;
+  for (int i = dim_max - 1; i >= 0; i--)
+  {
+    log_det += log_bound - log_r[i];
+    cost += std::exp(0.5 * log_det + log_ball[dim_max - i]);
+  }
+  return cost;
+}
+
+bool Enumerator::certify(const FP_NR<mpfr_t> &max_sqr_length)
+{
+  FP_NR<mpfr_t> y, newdist, xj;
+  newdist = 0.0;
+  for (int i = d - 1; i >= k; i--)
+  {
+    y = 0.0;
+    for (int j = d - 1; j > i; j--)
+    {
+      xj = x[j];
+      y.submul(xj, mu(j, i));
+    }
+    xj = x[i];
+    y.sub(y, xj);
+    y.mul(y, y);
+    newdist.addmul(y, r(i, i));
+  }
+  return newdist <= max_sqr_length;
+}
+
 bool Enumerator::enum_next(const FP_NR<mpfr_t> &max_sqr_length)
 {
-  FP_NR<mpfr_t> newdist, newcenter, y, volume, rtmp1;
+  // u = 2^-53 is the unit roundoff of double, the bounds below use eps = 2u
+  const double eps = std::ldexp(1.0, -52);
+  double bound     = max_sqr_length.get_d();
+  double bound_up  = bound * (1.0 + eps);
+  double volume;
   bool notFound = true;
 
   if (svp_init_needed)
   {
     for (k = d - 1; k > kmin; k--)
     {
-      cost_estimate(volume, max_sqr_length, r, k - 1);
+      volume = cost_estimate_d(bound, k - 1);
       if (volume <= max_volume)
         break;
     }
@@ -52,36 +105,54 @@ bool Enumerator::enum_next(const FP_NR<mpfr_t> &max_sqr_length)
   while (notFound)
   {
     // FPLLL_TRACE("Level k=" << k << " dist_k=" << dist[k] << " x_k=" << x[k]);
-    y.sub(center[k], x[k]);
-    newdist.mul(y, y);
-    newdist.mul(newdist, r(k, k));
-    newdist.add(newdist, dist[k]);
+    double y       = center[k] - x[k];
+    double newdist = dist[k] + y * y * r_d[k];
 
-    if (newdist <= max_sqr_length)
+    // errors of y and newdist with respect to the exact computation from mu and r
+    double y_err = center_err[k] + eps * std::abs(y);
+    double newdist_err =
+        dist_err[k] + (2.0 * std::abs(y) + y_err) * y_err * r_d[k] * (1.0 + eps) +
+        2.0 * eps * y * y * r_d[k] + eps * newdist;
+    newdist_err *= 1.0 + 8.0 * eps;
+
+    // The zigzag visits x[k] by increasing distance to the computed center, so the next values
+    // may be up to twice the error of the center closer to the exact one.
+    double y_low       = std::max(0.0, std::abs(y) - 2.0 * y_err);
+    double newdist_low = (dist[k] - dist_err[k]) + y_low * y_low * r_d[k] * (1.0 - 4.0 * eps);
+    newdist_low *= 1.0 - 4.0 * eps;
+
+    if (newdist_low <= bound_up)
     {
-      rtmp1.sub(max_sqr_length, newdist);
-      cost_estimate(volume, rtmp1, r, k - 1);
+      volume = cost_estimate_d(bound - newdist, k - 1);
       if (k > kmin && volume >= max_volume)
       {
         k--;
         // FPLLL_TRACE("  Go down, newdist=" << newdist);
 
-        newcenter = 0.0;
+        double newcenter = 0.0, center_abs = 0.0;
         for (int j = d - 1; j > k; j--)
-          newcenter.submul(x[j], mu(j, k));
+        {
+          newcenter -= x[j] * mu_d[j][k];
+          center_abs += std::abs(x[j] * mu_d[j][k]);
+        }
 
-        center[k] = newcenter;
-        dist[k]   = newdist;
-        x[k].rnd(newcenter);
-        dx[k]  = 0.0;
-        ddx[k] = newcenter >= x[k] ? -1.0 : 1.0;
+        center[k]     = newcenter;
+        center_err[k] = (d - k + 2) * eps * center_abs * (1.0 + eps);
+        dist[k]       = newdist;
+        dist_err[k]   = newdist_err;
+        x[k]          = std::round(newcenter);
+        dx[k]         = 0.0;
+        ddx[k]        = newcenter >= x[k] ? -1.0 : 1.0;
         continue;
       }
-      sub_tree.resize(d - k);
-      for (size_t j = 0; j < sub_tree.size(); j++)
-        sub_tree[j] = enumxt(x[j + k].get_d());
-      // FPLLL_TRACE("  SubTree approx_size=" << volume << " coord=" << sub_tree);
-      notFound = false;
+      if (newdist + newdist_err <= bound || certify(max_sqr_length))
+      {
+        sub_tree.resize(d - k);
+        for (size_t j = 0; j < sub_tree.size(); j++)
+          sub_tree[j] = enumxt(x[j + k]);
+        // FPLLL_TRACE("  SubTree approx_size=" << volume << " coord=" << sub_tree);
+        notFound = false;
+      }
     }
     else
     {
@@ -90,17 +161,16 @@ bool Enumerator::enum_next(const FP_NR<mpfr_t> &max_sqr_length)
     }
     if (k < kmax)
     {
-      ddx[k].neg(ddx[k]);
-      dx[k].sub(ddx[k], dx[k]);
-      x[k].add(x[k], dx[k]);
+      ddx[k] = -ddx[k];
+      dx[k]  = ddx[k] - dx[k];
+      x[k] += dx[k];
     }
     else
     {
       if (k >= d)
         break;
-      kmax  = k;
-      rtmp1 = 1.0;
-      x[k].add(x[k], rtmp1);
+      kmax = k;
+      x[k] += 1.0;
     }
     // FPLLL_TRACE("  x[" << k << "]=" << x[k]);
   }
@@ -23,6 +23,16 @@ FPLLL_BEGIN_NAMESPACE
 const double ENUM_MAX_VOLUME = 20000000;
 const int ENUM_MIN_LEVEL     = 20;
 
+/**
+ * @brief Top-level enumeration, which splits an enumeration into subtrees of bounded estimated
+ * volume.
+ *
+ * The search runs in double on a copy of mu and r. Each partial distance carries a rigorous bound
+ * on its forward error with respect to the values in mu and r, and a node is only discarded when
+ * its distance certainly exceeds the bound. The subtrees returned are therefore a superset of the
+ * ones an exact search would return. When the bound cannot decide whether the last node of a
+ * subtree is inside the ball, its distance is recomputed from mu and r in FP_NR<mpfr_t>.
+ */
 class Enumerator
 {
 public:
@@ -32,14 +42,23 @@ public:
   inline const vector<enumxt> &get_sub_tree() { return sub_tree; }
 
 private:
+  /* cost_estimate (see util.h) in double, from the logarithms of r(i, i) */
+  double cost_estimate_d(double bound, int dim_max);
+  /* returns true if the partial distance of x[k], ..., x[d - 1] computed in FP_NR<mpfr_t> is at
+     most max_sqr_length */
+  bool certify(const FP_NR<mpfr_t> &max_sqr_length);
+
   const Matrix<FP_NR<mpfr_t>> &mu;
   const Matrix<FP_NR<mpfr_t>> &r;
   int k, kmin, kmax, d;
-  vector<FP_NR<mpfr_t>> center, dist;
-  vector<FP_NR<mpfr_t>> x, dx, ddx;
-  //  vector<FP_NR<mpfr_t>> sub_tree;
+  // mu and r rounded to double, log(r(i, i)) and log of the volume of the unit ball of dimension i
+  vector<vector<enumf>> mu_d;
+  vector<enumf> r_d, log_r, log_ball;
+  // center_err[k] and dist_err[k] bound the errors of center[k] and dist[k]
+  vector<enumf> center, center_err, dist, dist_err;
+  vector<enumf> x, dx, ddx;
   vector<enumxt> sub_tree;
-  FP_NR<mpfr_t> max_volume;
+  double max_volume;
   bool svp_init_needed;
 };
 
@@ -22,14 +22,21 @@
 #error fplll needs at least a C++11 compliant compiler
 #endif
 
+#include "async.h"
 #include "bkz.h"
 #include "bkz_param.h"
+#include "context.h"
+#include "decompose.h"
 #include "gso_gram.h"
+#include "hbkz.h"
 #include "hlll.h"
+#include "progress.h"
 #include "pruner/pruner.h"
 #include "svpcvp.h"
 #include "threadpool.h"
+#include "trace.h"
 #include "util.h"
+#include "verify.h"
 #include "wrapper.h"
 
 #endif
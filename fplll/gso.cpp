@@ -49,6 +49,35 @@ template <class ZT, class FT> void MatGSO<ZT, FT>::update_bf(int i)
 
 template <class ZT, class FT> void MatGSO<ZT, FT>::invalidate_gram_row(int i)
 {
+  if (gram_window > 0)
+  {
+    if (gf.is_row_stored(i))
+    {
+      gf.store_triangular_row(i, false);
+      n_gram_rows--;
+    }
+    return;
+  }
+  for (int j = 0; j <= i; j++)
+    gf(i, j).set_nan();
+}
+
+template <class ZT, class FT> void MatGSO<ZT, FT>::store_gram_row(int i)
+{
+  if (n_gram_rows >= gram_window)
+  {
+    int farthest = -1;
+    for (int k = 0; k < gf.get_rows(); k++)
+    {
+      if (k != i && gf.is_row_stored(k) &&
+          (farthest < 0 || std::abs(k - i) > std::abs(farthest - i)))
+        farthest = k;
+    }
+    gf.store_triangular_row(farthest, false);
+    n_gram_rows--;
+  }
+  gf.store_triangular_row(i, true);
+  n_gram_rows++;
   for (int j = 0; j <= i; j++)
     gf(i, j).set_nan();
 }
@@ -83,6 +112,7 @@ template <class ZT, class FT> void MatGSO<ZT, FT>::discover_row()
 
 template <class ZT, class FT> void MatGSO<ZT, FT>::row_add(int i, int j)
 {
+  counters.row_add++;
   b[i].add(b[j], n_known_cols);
   if (enable_transform)
   {
@@ -106,6 +136,7 @@ template <class ZT, class FT> void MatGSO<ZT, FT>::row_add(int i, int j)
 
 template <class ZT, class FT> void MatGSO<ZT, FT>::row_sub(int i, int j)
 {
+  counters.row_add++;
   b[i].sub(b[j], n_known_cols);
   if (enable_transform)
   {
@@ -129,6 +160,7 @@ template <class ZT, class FT> void MatGSO<ZT, FT>::row_sub(int i, int j)
 
 template <class ZT, class FT> void MatGSO<ZT, FT>::row_addmul_si(int i, int j, long x)
 {
+  counters.row_addmul_si++;
   b[i].addmul_si(b[j], x, n_known_cols);
   if (enable_transform)
   {
@@ -162,6 +194,7 @@ template <class ZT, class FT> void MatGSO<ZT, FT>::row_addmul_si(int i, int j, l
 template <class ZT, class FT>
 void MatGSO<ZT, FT>::row_addmul_si_2exp(int i, int j, long x, long expo)
 {
+  counters.row_addmul_2exp++;
   b[i].addmul_si_2exp(b[j], x, expo, n_known_cols, ztmp1);
   if (enable_transform)
   {
@@ -197,6 +230,7 @@ void MatGSO<ZT, FT>::row_addmul_si_2exp(int i, int j, long x, long expo)
 template <class ZT, class FT>
 void MatGSO<ZT, FT>::row_addmul_2exp(int i, int j, const ZT &x, long expo)
 {
+  counters.row_addmul_2exp++;
   b[i].addmul_2exp(b[j], x, expo, n_known_cols, ztmp1);
   if (enable_transform)
   {
@@ -236,6 +270,7 @@ void MatGSO<ZT, FT>::row_addmul_2exp(int i, int j, const ZT &x, long expo)
 template <class ZT, class FT>
 void MatGSO<ZT, FT>::row_addmul_we(int i, int j, const FT &x, long expo_add)
 {
+  counters.row_addmul_we++;
   FPLLL_DEBUG_CHECK(j >= 0 && /* i > j &&*/ i < n_known_rows && j < n_source_rows);
 
   long expo;
@@ -298,8 +333,8 @@ template <class ZT, class FT> void MatGSO<ZT, FT>::move_row(int old_r, int new_r
     }
     rotate(gso_valid_cols.begin() + new_r, gso_valid_cols.begin() + old_r,
            gso_valid_cols.begin() + old_r + 1);
-    mu.rotate_right(new_r, old_r);
-    r.rotate_right(new_r, old_r);
+    mu.rotate_triangular_right(new_r, old_r);
+    r.rotate_triangular_right(new_r, old_r);
     b.rotate_right(new_r, old_r);
     if (enable_transform)
     {
@@ -327,8 +362,8 @@ template <class ZT, class FT> void MatGSO<ZT, FT>::move_row(int old_r, int new_r
     }
     rotate(gso_valid_cols.begin() + old_r, gso_valid_cols.begin() + old_r + 1,
            gso_valid_cols.begin() + new_r + 1);
-    mu.rotate_left(old_r, new_r);
-    r.rotate_left(old_r, new_r);
+    mu.rotate_triangular_left(old_r, new_r);
+    r.rotate_triangular_left(old_r, new_r);
     b.rotate_left(old_r, new_r);
     if (enable_transform)
     {
@@ -363,6 +398,13 @@ template <class ZT, class FT> void MatGSO<ZT, FT>::move_row(int old_r, int new_r
       }
     }
   }
+  if (gram_window > 0)
+  {
+    // rotate_gram_left/right may have left rows of gf out
+    n_gram_rows = 0;
+    for (int i = 0; i < gf.get_rows(); i++)
+      n_gram_rows += gf.is_row_stored(i);
+  }
 }
 
 template <class ZT, class FT> void MatGSO<ZT, FT>::size_increased()
@@ -373,15 +415,15 @@ template <class ZT, class FT> void MatGSO<ZT, FT>::size_increased()
   {
     if (enable_int_gram)
     {
-      g.resize(d, d);
+      g.resize_triangular(d);
     }
     else
     {
       bf.resize(d, b.get_cols());
-      gf.resize(d, d);
+      gf.resize_triangular(d, gram_window == 0);
     }
-    mu.resize(d, d);
-    r.resize(d, d);
+    mu.resize_triangular(d);
+    r.resize_triangular(d);
     gso_valid_cols.resize(d);
     init_row_size.resize(d);
     if (enable_row_expo)
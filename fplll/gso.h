@@ -41,6 +41,7 @@ public:
   using MatGSOInterface<ZT, FT>::cols_locked;  // maybe scratch.
   using MatGSOInterface<ZT, FT>::enable_int_gram;
   using MatGSOInterface<ZT, FT>::gso_valid_cols;
+  using MatGSOInterface<ZT, FT>::invalidate_log_r_sums;
   using MatGSOInterface<ZT, FT>::enable_inverse_transform;
   using MatGSOInterface<ZT, FT>::u_inv_t;
   using MatGSOInterface<ZT, FT>::sym_g;
@@ -49,6 +50,7 @@ public:
   using MatGSOInterface<ZT, FT>::ztmp1;
   using MatGSOInterface<ZT, FT>::ztmp2;
   using MatGSOInterface<ZT, FT>::row_op_force_long;
+  using MatGSOInterface<ZT, FT>::counters;
   using MatGSOInterface<ZT, FT>::alloc_dim;
   using MatGSOInterface<ZT, FT>::get_mu;
   using MatGSOInterface<ZT, FT>::get_r;
@@ -108,12 +110,20 @@ public:
    * @param row_op_force_long
    *   Affects the behaviour of row_addmul(_we).
    *   See the documentation of row_addmul.
+   * @param gram_window (GSO_WINDOW)
+   *   If enable_int_gram=false, only keeps GSO_DEF_WINDOW rows of the floating-point Gram
+   *   matrix, the ones closest to the last row asked to get_gram. The coefficients of the other
+   *   rows are computed again from bf when needed. This bounds the memory of the Gram matrix in
+   *   large dimensions, at the price of more dot products. It has no effect if
+   *   enable_int_gram=true.
    */
   MatGSO(Matrix<ZT> &arg_b, Matrix<ZT> &arg_u, Matrix<ZT> &arg_uinv_t, int flags)
       : MatGSOInterface<ZT, FT>(arg_u, arg_uinv_t, flags), b(arg_b)
   {
     FPLLL_DEBUG_CHECK(!(enable_int_gram && enable_row_expo));
-    d = b.get_rows();
+    d           = b.get_rows();
+    gram_window = (flags & GSO_WINDOW) && !enable_int_gram ? GSO_DEF_WINDOW : 0;
+    n_gram_rows = 0;
     if (enable_row_expo)
     {
       tmp_col_expo.resize(b.get_cols());
@@ -199,6 +209,15 @@ private:
   /* Marks g(i, j) for all j <= i (but NOT for j > i) */
   virtual void invalidate_gram_row(int i);
 
+  /* With GSO_WINDOW, stores row i of gf with invalid coefficients, leaving out the stored row
+     farthest from i if the window is full. */
+  void store_gram_row(int i);
+
+  /* Number of rows of gf kept with GSO_WINDOW (0 if all of them are kept) and number of rows
+     of gf currently stored in this case */
+  int gram_window;
+  int n_gram_rows;
+
   // b[i] <- b[i] + x * b[j] (i > j)
   virtual void row_addmul_si(int i, int j, long x);
   // b[i] <- b[i] + (2^expo * x) * b[j] (i > j)
@@ -267,6 +286,8 @@ template <class ZT, class FT> inline FT &MatGSO<ZT, FT>::get_gram(FT &f, int i,
   }
   else
   {
+    if (gram_window > 0 && !gf.is_row_stored(i))
+      store_gram_row(i);
     if (gf(i, j).is_nan())
     {
       bf[i].dot_product(gf(i, j), bf[j], n_known_cols);
@@ -321,6 +342,7 @@ template <class ZT, class FT> inline void MatGSO<ZT, FT>::remove_last_rows(int n
 {
   FPLLL_DEBUG_CHECK(!cols_locked && d >= n_removed_rows);
   d -= n_removed_rows;
+  invalidate_log_r_sums(d);
   n_known_rows  = min(n_known_rows, d);
   n_source_rows = n_known_rows;
   b.set_rows(d);
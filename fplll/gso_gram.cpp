@@ -50,6 +50,7 @@ template <class ZT, class FT> void MatGSOGram<ZT, FT>::invalidate_gram_row(int)
 
 template <class ZT, class FT> void MatGSOGram<ZT, FT>::row_add(int i, int j)
 {
+  counters.row_add++;
   if (enable_transform)
   {
     u[i].add(u[j]);
@@ -79,6 +80,7 @@ template <class ZT, class FT> void MatGSOGram<ZT, FT>::row_add(int i, int j)
 
 template <class ZT, class FT> void MatGSOGram<ZT, FT>::row_sub(int i, int j)
 {
+  counters.row_add++;
   if (enable_transform)
   {
     u[i].sub(u[j]);
@@ -106,6 +108,7 @@ template <class ZT, class FT> void MatGSOGram<ZT, FT>::row_sub(int i, int j)
 
 template <class ZT, class FT> void MatGSOGram<ZT, FT>::row_addmul_si(int i, int j, long x)
 {
+  counters.row_addmul_si++;
   if (enable_transform)
   {
     u[i].addmul_si(u[j], x);
@@ -144,6 +147,7 @@ template <class ZT, class FT> void MatGSOGram<ZT, FT>::row_addmul_si(int i, int
 template <class ZT, class FT>
 void MatGSOGram<ZT, FT>::row_addmul_si_2exp(int i, int j, long x, long expo)
 {
+  counters.row_addmul_2exp++;
   if (enable_transform)
   {
     u[i].addmul_si_2exp(u[j], x, expo, ztmp1);
@@ -183,6 +187,7 @@ void MatGSOGram<ZT, FT>::row_addmul_si_2exp(int i, int j, long x, long expo)
 template <class ZT, class FT>
 void MatGSOGram<ZT, FT>::row_addmul_2exp(int i, int j, const ZT &x, long expo)
 {
+  counters.row_addmul_2exp++;
   if (enable_transform)
   {
     u[i].addmul_2exp(u[j], x, expo, ztmp1);
@@ -227,6 +232,7 @@ void MatGSOGram<ZT, FT>::row_addmul_2exp(int i, int j, const ZT &x, long expo)
 template <class ZT, class FT>
 void MatGSOGram<ZT, FT>::row_addmul_we(int i, int j, const FT &x, long expo_add)
 {
+  counters.row_addmul_we++;
   FPLLL_DEBUG_CHECK(j >= 0 && i < n_known_rows && j < n_source_rows);
   long expo;
   long lx = x.get_si_exp_we(expo, expo_add);
@@ -292,8 +298,8 @@ template <class ZT, class FT> void MatGSOGram<ZT, FT>::move_row(int old_r, int n
     }
     rotate(gso_valid_cols.begin() + new_r, gso_valid_cols.begin() + old_r,
            gso_valid_cols.begin() + old_r + 1);
-    mu.rotate_right(new_r, old_r);
-    r.rotate_right(new_r, old_r);
+    mu.rotate_triangular_right(new_r, old_r);
+    r.rotate_triangular_right(new_r, old_r);
     if (enable_transform)
     {
       u.rotate_right(new_r, old_r);
@@ -321,8 +327,8 @@ template <class ZT, class FT> void MatGSOGram<ZT, FT>::move_row(int old_r, int n
     }
     rotate(gso_valid_cols.begin() + old_r, gso_valid_cols.begin() + old_r + 1,
            gso_valid_cols.begin() + new_r + 1);
-    mu.rotate_left(old_r, new_r);
-    r.rotate_left(old_r, new_r);
+    mu.rotate_triangular_left(old_r, new_r);
+    r.rotate_triangular_left(old_r, new_r);
 
     if (enable_transform)
     {
@@ -367,8 +373,8 @@ template <class ZT, class FT> void MatGSOGram<ZT, FT>::size_increased()
     }
     gptr->resize(d, d);
 
-    mu.resize(d, d);
-    r.resize(d, d);
+    mu.resize_triangular(d);
+    r.resize_triangular(d);
     gso_valid_cols.resize(d);
     alloc_dim = d;
   }
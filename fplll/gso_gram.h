@@ -42,6 +42,7 @@ public:
   using MatGSOInterface<ZT, FT>::cols_locked;  // maybe scratch.
   using MatGSOInterface<ZT, FT>::enable_int_gram;
   using MatGSOInterface<ZT, FT>::gso_valid_cols;
+  using MatGSOInterface<ZT, FT>::invalidate_log_r_sums;
   using MatGSOInterface<ZT, FT>::enable_inverse_transform;
   using MatGSOInterface<ZT, FT>::u_inv_t;
   using MatGSOInterface<ZT, FT>::sym_g;
@@ -50,6 +51,7 @@ public:
   using MatGSOInterface<ZT, FT>::ztmp1;
   using MatGSOInterface<ZT, FT>::ztmp2;
   using MatGSOInterface<ZT, FT>::row_op_force_long;
+  using MatGSOInterface<ZT, FT>::counters;
   using MatGSOInterface<ZT, FT>::alloc_dim;
   using MatGSOInterface<ZT, FT>::get_mu;
   using MatGSOInterface<ZT, FT>::get_r;
@@ -265,6 +267,7 @@ template <class ZT, class FT> inline void MatGSOGram<ZT, FT>::remove_last_rows(i
 {
   FPLLL_DEBUG_CHECK(!cols_locked && d >= n_removed_rows);
   d -= n_removed_rows;
+  invalidate_log_r_sums(d);
   n_known_rows  = min(n_known_rows, d);
   n_source_rows = n_known_rows;
   if (enable_transform)
@@ -27,6 +27,8 @@ inline void MatGSOInterface<ZT, FT>::invalidate_gso_row(int i, int new_valid_col
 {
   FPLLL_DEBUG_CHECK(i >= 0 && i < n_known_rows && new_valid_cols >= 0 && new_valid_cols <= i + 1);
   gso_valid_cols[i] = min(gso_valid_cols[i], new_valid_cols);
+  if (new_valid_cols <= i)
+    invalidate_log_r_sums(i);
 }
 
 template <class ZT, class FT> void MatGSOInterface<ZT, FT>::row_op_end(int first, int last)
@@ -42,7 +44,10 @@ template <class ZT, class FT> void MatGSOInterface<ZT, FT>::row_op_end(int first
       update_bf(i);
       invalidate_gram_row(i);
       for (int j = i + 1; j < n_known_rows; j++)
-        gf(j, i).set_nan();
+      {
+        if (gf.is_row_stored(j))
+          gf(j, i).set_nan();
+      }
     }
     invalidate_gso_row(i, 0);
   }
@@ -61,16 +66,17 @@ template <class ZT, class FT> inline ZT MatGSOInterface<ZT, FT>::get_max_gram()
     {
       throw std::runtime_error("Error: gptr is equal to the nullpointer.");
     }
-    Matrix<ZT> gr = *gptr;
-    tmp           = gr(0, 0);
+    Matrix<ZT> &gr = *gptr;
+    tmp            = gr(0, 0);
     for (int i = 0; i < n_known_rows; i++)
       tmp = tmp.max_z(gr(i, i));
   }
   else
   {
-    FT tmp1 = gf(0, 0);
+    FT tmp1, tmp2;
+    get_gram(tmp1, 0, 0);
     for (int i = 0; i < n_known_rows; i++)
-      tmp1 = tmp1.max_f(gf(i, i));
+      tmp1 = tmp1.max_f(get_gram(tmp2, i, i));
     tmp.set_f(tmp1);
   }
   return tmp;
@@ -139,6 +145,8 @@ template <class ZT, class FT> bool MatGSOInterface<ZT, FT>::update_gso_row(int i
   FPLLL_DEBUG_CHECK(i >= 0 && i < n_known_rows && last_j >= 0 && last_j < n_source_rows);
 
   int j = max(0, gso_valid_cols[i]);
+  if (j <= last_j)
+    counters.gso_row_updates++;
 
   for (; j <= last_j; j++)
   {
@@ -169,6 +177,7 @@ template <class ZT, class FT> void MatGSOInterface<ZT, FT>::unlock_cols()
 {
   n_known_rows = n_source_rows;
   cols_locked  = false;
+  invalidate_log_r_sums(n_known_rows);
 }
 
 template <class ZT, class FT>
@@ -194,32 +203,66 @@ void MatGSOInterface<ZT, FT>::apply_transform(const Matrix<FT> &transform, int s
   remove_last_rows(target_size);
 }
 
-template <class ZT, class FT>
-double MatGSOInterface<ZT, FT>::get_current_slope(int start_row, int stop_row)
+template <class ZT, class FT> void MatGSOInterface<ZT, FT>::update_log_r_sums(int end_row)
 {
+  if (end_row <= log_r_valid)
+    return;
+  if (static_cast<int>(log_r_sum.size()) <= end_row)
+  {
+    log_r_sum.resize(d + 1);
+    log_r_sum_x.resize(d + 1);
+    log_r_sum_ix.resize(d + 1);
+    log_r_bad.resize(d + 1);
+  }
+  if (log_r_valid == 0)
+  {
+    log_r_sum[0]    = 0.0;
+    log_r_sum_x[0]  = 0.0;
+    log_r_sum_ix[0] = 0.0;
+    log_r_bad[0]    = 0;
+  }
   FT f, log_f;
   long expo;
-  vector<double> x;
-  x.resize(stop_row);
-  for (int i = start_row; i < stop_row; i++)
+  for (int i = log_r_valid; i < end_row; i++)
   {
     update_gso_row(i);
     f = get_r_exp(i, i, expo);
+    log_r_sum[i + 1]    = log_r_sum[i];
+    log_r_sum_x[i + 1]  = log_r_sum_x[i];
+    log_r_sum_ix[i + 1] = log_r_sum_ix[i];
+    log_r_bad[i + 1]    = log_r_bad[i];
+    if (f <= 0.0)
+    {
+      log_r_bad[i + 1]++;
+      continue;
+    }
     log_f.log(f, GMP_RNDU);
-    x[i] = log_f.get_d() + expo * std::log(2.0);
+    double x = log_f.get_d() + expo * std::log(2.0);
+    if (expo != 0)
+    {
+      f = expo * std::log(2.0);
+      log_f.add(log_f, f);
+    }
+    log_r_sum[i + 1] += log_f;
+    log_r_sum_x[i + 1] += x;
+    log_r_sum_ix[i + 1] += i * x;
   }
+  log_r_valid = end_row;
+}
+
+template <class ZT, class FT>
+double MatGSOInterface<ZT, FT>::get_current_slope(int start_row, int stop_row)
+{
+  FPLLL_DEBUG_CHECK(start_row >= 0 && stop_row <= d);
+  update_log_r_sums(stop_row);
+  if (log_r_bad[stop_row] != log_r_bad[start_row])
+    return NAN;
+  // least squares fit of x_i = log(r(i, i)) against i, centered on the mean of i
   int n         = stop_row - start_row;
-  double i_mean = (n - 1) * 0.5 + start_row, x_mean = 0, v1 = 0, v2 = 0;
-  for (int i = start_row; i < stop_row; i++)
-  {
-    x_mean += x[i];
-  }
-  x_mean /= n;
-  for (int i = start_row; i < stop_row; i++)
-  {
-    v1 += (i - i_mean) * (x[i] - x_mean);
-    v2 += (i - i_mean) * (i - i_mean);
-  }
+  double i_mean = (n - 1) * 0.5 + start_row;
+  double v1     = (log_r_sum_ix[stop_row] - log_r_sum_ix[start_row]) -
+              i_mean * (log_r_sum_x[stop_row] - log_r_sum_x[start_row]);
+  double v2 = n * ((double)n * n - 1) / 12.0;
   return v1 / v2;
 }
 
@@ -238,12 +281,21 @@ template <class ZT, class FT> FT MatGSOInterface<ZT, FT>::get_log_det(int start_
   FT log_det = 0.0;
   start_row  = max(0, start_row);
   end_row    = min(d, end_row);
-  FT h;
-  for (int i = start_row; i < end_row; ++i)
+  if (start_row >= end_row)
+    return log_det;
+  update_log_r_sums(end_row);
+  if (log_r_bad[end_row] != log_r_bad[start_row])
   {
-    get_r(h, i, i);
-    log_det += log(h);
+    // some r(i, i) <= 0, the log is not finite
+    FT h;
+    for (int i = start_row; i < end_row; ++i)
+    {
+      get_r(h, i, i);
+      log_det += log(h);
+    }
+    return log_det;
   }
+  log_det.sub(log_r_sum[end_row], log_r_sum[start_row]);
   return log_det;
 }
 
@@ -19,6 +19,7 @@
 #ifndef FPLLL_GSOInterface_H
 #define FPLLL_GSOInterface_H
 
+#include "counters.h"
 #include "nr/matrix.h"
 
 FPLLL_BEGIN_NAMESPACE
@@ -28,9 +29,13 @@ enum MatGSOInterfaceFlags
   GSO_DEFAULT       = 0,
   GSO_INT_GRAM      = 1,
   GSO_ROW_EXPO      = 2,
-  GSO_OP_FORCE_LONG = 4
+  GSO_OP_FORCE_LONG = 4,
+  GSO_WINDOW        = 8
 };
 
+/* Number of rows of the floating-point Gram matrix kept by MatGSO with GSO_WINDOW */
+const int GSO_DEF_WINDOW = 64;
+
 /**
    @brief Use Gaussian Heuristic to compute a bound on the length of the
    shortest vector
@@ -98,7 +103,7 @@ public:
         enable_transform(arg_u.get_rows() > 0), enable_inverse_transform(arg_uinv_t.get_rows() > 0),
         row_op_force_long(flags & GSO_OP_FORCE_LONG), u(arg_u), u_inv_t(arg_uinv_t),
         n_known_rows(0), n_source_rows(0), n_known_cols(0), cols_locked(false), alloc_dim(0),
-        gptr(nullptr)
+        gptr(nullptr), log_r_valid(0)
   {
 #ifdef DEBUG
     row_op_first = row_op_last = -1;
@@ -199,7 +204,7 @@ public:
   /**
    * Returns the mu matrix
    * Coefficients of the Gram Schmidt Orthogonalization
-   * (lower triangular matrix)
+   * (lower triangular matrix, row i only stores its first i + 1 elements)
    * mu(i, j) = r(i, j) / ||b*_j||^2.
    */
   const Matrix<FT> &get_mu_matrix() { return mu; }
@@ -207,14 +212,14 @@ public:
   /**
    * Returns the r matrix
    * Coefficients of the Gram Schmidt Orthogonalization
-   * (lower triangular matrix)
+   * (lower triangular matrix, row i only stores its first i + 1 elements)
    */
   const Matrix<FT> &get_r_matrix() { return r; }
 
   /**
    * Returns the g matrix (Z_NR version of r)
    * Coefficients of the Gram Schmidt Orthogonalization
-   * (lower triangular matrix)
+   * (lower triangular matrix; in MatGSO, row i only stores its first i + 1 elements)
    */
   const Matrix<ZT> &get_g_matrix()
   {
@@ -410,7 +415,9 @@ public:
      @brief Return slope of the curve fitted to the lengths of the vectors from
      `start_row` to `stop_row`.
 
-     The slope gives an indication of the quality of the basis.
+     The slope gives an indication of the quality of the basis. It is computed from prefix sums
+     of log(r(i, i)) that are kept between calls, so only the rows changed since the last call
+     are visited.
 
      @param start_row start row (inclusive)
      @param stop_row  stop row (exclusive)
@@ -429,7 +436,8 @@ public:
   FT get_root_det(int start_row, int end_row);
 
   /**
-     @brief Return log of the (squared) determinant of the basis.
+     @brief Return log of the (squared) determinant of the basis. Uses the same prefix sums as
+     get_current_slope.
 
      @param start_row start row (inclusive)
      @param end_row   stop row (exclusive)
@@ -475,6 +483,9 @@ public:
    */
   const bool row_op_force_long;
 
+  /** Row operations and GSO row recomputations performed through this object. */
+  GSOCounters counters;
+
 protected:
   /** Allocates matrices and arrays whose size depends on d (all but tmp_col_expo).
    * When enable_int_gram=false, initializes bf.
@@ -545,6 +556,8 @@ protected:
    *
    * mu(i, j) is valid if 0 &lt;= i &lt; n_known_rows (&lt;= d) and
    * 0 &lt;= j &lt; min(gso_valid_cols[i], i)
+   *
+   * Only the lower triangle is stored (see Matrix::resize_triangular).
    */
   Matrix<FT> mu;
 
@@ -559,6 +572,8 @@ protected:
    *
    * r(i, j) is valid if 0 &lt;= i &lt; n_known_rows (&lt;= d) and
    * 0 &lt;= j &lt; gso_valid_cols[i] (&lt;= i + 1).
+   *
+   * Only the lower triangle is stored (see Matrix::resize_triangular).
    */
   Matrix<FT> r;
 
@@ -570,17 +585,33 @@ public:
    */
 
   /* Gram matrix (dot products of basis vectors, lower triangular matrix)
-   g(i, j) is valid if 0 <= i < n_known_rows and j <= i */
+   g(i, j) is valid if 0 <= i < n_known_rows and j <= i. The matrix of MatGSO only stores the
+   lower triangle, the one given to MatGSOGram may be square. */
   Matrix<ZT> *gptr;
   //  Matrix<ZT> g;
 
 protected:
+  // Floating-point Gram matrix when enable_int_gram=false, lower triangle only
   Matrix<FT> gf;
 
   /* Number of valid columns of the i-th row of mu and r.
      Valid only for 0 <= i < n_known_rows */
   vector<int> gso_valid_cols;
 
+  /* Prefix sums of log(r(i, i)) used by get_log_det and get_current_slope, valid for
+     0 <= k <= log_r_valid. With x_i = log(r(i, i)), log_r_sum[k] is the sum of x_i for i < k in FT,
+     log_r_sum_x[k] and log_r_sum_ix[k] the sums of x_i and i * x_i in double, and log_r_bad[k]
+     the number of rows i < k with r(i, i) <= 0, which are left out of the sums. */
+  vector<FT> log_r_sum;
+  vector<double> log_r_sum_x, log_r_sum_ix;
+  vector<int> log_r_bad;
+  int log_r_valid;
+
+  /* Called when r(i, i) changes. */
+  void invalidate_log_r_sums(int i) { log_r_valid = min(log_r_valid, i); }
+  /* Extends the prefix sums up to end_row, computing the missing rows of the GSO. */
+  void update_log_r_sums(int end_row);
+
   /* Used by update_gso_row (+ update_gso), get_max_mu_exp and row_addmul_we. */
   FT ftmp1, ftmp2;
   /* Used by row_add, row_sub, row_addmul_si_2exp, row_addmul_2exp and
@@ -610,11 +641,12 @@ template <class ZT, class FT> inline void MatGSOInterface<ZT, FT>::symmetrize_g(
     throw std::runtime_error("Error: gptr is equal to the nullpointer.");
   }
   Matrix<ZT> &gr = *gptr;
+  // Nothing to do on the rows which only store the lower triangle
   for (int i = 0; i < d; i++)
   {
-    for (int j = 0; j < d; j++)
+    for (int j = i + 1; j < min(d, gr[i].size()); j++)
     {
-      gr(i, j) = sym_g(i, j);
+      gr(i, j) = gr(j, i);
     }
   }
 }
@@ -715,6 +747,8 @@ template <class ZT, class FT> inline void MatGSOInterface<ZT, FT>::set_r(int i,
   r(i, j) = f;
   if (gso_valid_cols[i] == j)
     gso_valid_cols[i]++;
+  if (i == j)
+    invalidate_log_r_sums(i);
 }
 
 template <class ZT, class FT>
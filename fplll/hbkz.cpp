@@ -0,0 +1,340 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "hbkz.h"
+#include "bkz.h"
+#include "trace.h"
+#include "util.h"
+#include <iomanip>
+
+FPLLL_BEGIN_NAMESPACE
+
+/* Local copies of a block are scaled so that the smallest diagonal coefficient of R in the block
+   is about 2^HBKZ_LOCAL_BITS: the rounding error on the local basis is then below 2^-24 relatively
+   to the shortest Gram-Schmidt vector of the block. */
+static const long HBKZ_LOCAL_BITS = 24;
+
+// svp_reduction of the whole local block, returns the number of enumeration nodes
+template <class ZL>
+static long hbkz_local_svp_reduction(ZZ_mat<ZL> &b, ZZ_mat<ZL> &u, const BKZParam &par)
+{
+  ZZ_mat<ZL> u_inv;
+  double lll_delta = par.delta < 1 ? par.delta : LLL_DEF_DELTA;
+  MatGSO<Z_NR<ZL>, FP_NR<double>> m(b, u, u_inv, GSO_ROW_EXPO);
+  LLLReduction<Z_NR<ZL>, FP_NR<double>> lll_obj(m, lll_delta, LLL_DEF_ETA, LLL_NO_TARGET);
+  if (!lll_obj.lll())
+  {
+    if (lll_obj.status == RED_CANCELLED)
+      throw RED_CANCELLED;
+    throw std::runtime_error(RED_STATUS_STR[lll_obj.status]);
+  }
+  BKZReduction<Z_NR<ZL>, FP_NR<double>> bkz_obj(m, lll_obj, par);
+  bkz_obj.svp_reduction(0, b.get_rows(), par);
+  return bkz_obj.nodes;
+}
+
+template <class ZT, class FT>
+HBKZReduction<ZT, FT>::HBKZReduction(MatHouseholder<ZT, FT> &m, HLLLReduction<ZT, FT> &hlll_obj,
+                                     const BKZParam &param)
+    : status(RED_SUCCESS), nodes(0), param(param), m(m), hlll_obj(hlll_obj), n_reduced(0),
+      cputime_start(0), control(get_reduction_control()), current_tour(0)
+{
+  for (num_rows = m.get_d(); num_rows > 0 && m.get_b(num_rows - 1).is_zero(); num_rows--)
+  {
+  }
+}
+
+template <class ZT, class FT> void HBKZReduction<ZT, FT>::hlll_prefix(int end)
+{
+  if (end <= n_reduced)
+    return;
+  if (!hlll_obj.hlll(n_reduced, end))
+    throw std::runtime_error(RED_STATUS_STR[hlll_obj.get_status()]);
+  n_reduced = end;
+}
+
+template <class ZT, class FT>
+bool HBKZReduction<ZT, FT>::svp_reduction(int kappa, int block_size, const BKZParam &par)
+{
+  FPLLL_TRACE_ZONE("HBKZReduction::svp_reduction");
+
+  if (control && control->is_cancelled())
+    throw RED_CANCELLED;
+
+  hlll_prefix(kappa + block_size);
+
+  FT f, old_first;
+  long expo, old_first_expo;
+  m.get_R(old_first, kappa, kappa, old_first_expo);
+
+  long scale = LONG_MAX;
+  for (int i = 0; i < block_size; i++)
+  {
+    m.get_R(f, kappa + i, kappa + i, expo);
+    scale = min(scale, f.exponent() + expo);
+  }
+  scale = HBKZ_LOCAL_BITS - scale;
+
+  // local basis: R restricted to the block, R(i, j) = f * 2^expo
+  ZZ_mat<mpz_t> local_b(block_size, block_size), local_u;
+  for (int i = 0; i < block_size; i++)
+  {
+    for (int j = 0; j <= i; j++)
+    {
+      m.get_R(f, kappa + i, kappa + j, expo);
+      f.mul_2si(f, expo + scale);
+      f.rnd(f);
+      local_b(i, j).set_f(f);
+    }
+  }
+
+  // the local reduction is a plain svp_reduction
+  BKZParam local_par = par;
+  local_par.flags &= ~(BKZ_VERBOSE | BKZ_DUMP_GSO | BKZ_LOCAL_PREPROC);
+
+  ZZ_mat<long> local_bl, local_ul;
+  if (convert<long, mpz_t>(local_bl, local_b, 10))
+  {
+    local_ul.gen_identity(block_size);
+    nodes += hbkz_local_svp_reduction(local_bl, local_ul, local_par);
+    convert<mpz_t, long>(local_u, local_ul, 0);
+  }
+  else
+  {
+    local_u.gen_identity(block_size);
+    nodes += hbkz_local_svp_reduction(local_b, local_u, local_par);
+  }
+
+  // the local reduction reported its own rows
+  if (control)
+    control->report_bkz(kappa, current_tour);
+
+  Matrix<ZT> transform(block_size, block_size);
+  bool identity = true;
+  for (int i = 0; i < block_size; i++)
+  {
+    for (int j = 0; j < block_size; j++)
+    {
+      transform(i, j) = local_u(i, j).get_data();
+      identity &= (local_u(i, j) == (i == j ? 1 : 0));
+    }
+  }
+  if (identity)
+    return true;
+
+  m.apply_transform(transform, kappa);
+  n_reduced = min(n_reduced, kappa);
+  hlll_prefix(kappa + block_size);
+
+  if (control && control->get_target_norm() > 0)
+  {
+    m.norm_square_b_row(f, kappa, expo);
+    f.mul_2si(f, expo);
+    if (control->check_target(f.get_d()))
+      throw RED_CANCELLED;
+  }
+
+  // as in BKZReduction::svp_reduction, progress is measured on the first vector of the block
+  FT new_first;
+  long new_first_expo;
+  m.get_R(new_first, kappa, kappa, new_first_expo);
+  new_first.mul_2si(new_first, new_first_expo - old_first_expo);
+  return old_first <= new_first;
+}
+
+template <class ZT, class FT>
+bool HBKZReduction<ZT, FT>::tour(const int loop, const BKZParam &par, int min_row, int max_row)
+{
+  bool clean     = true;
+  int block_size = par.block_size;
+  for (int kappa = min_row; kappa < max_row - block_size; ++kappa)
+    clean &= svp_reduction(kappa, block_size, par);
+  for (int kappa = max(max_row - block_size, min_row); kappa < max_row - 1; ++kappa)
+    clean &= svp_reduction(kappa, max_row - kappa, par);
+  hlll_prefix(max_row);
+
+  if (par.flags & BKZ_VERBOSE)
+  {
+    print_tour(loop, min_row, max_row);
+  }
+
+  return clean;
+}
+
+template <class ZT, class FT> bool HBKZReduction<ZT, FT>::bkz()
+{
+  int flags        = param.flags;
+  int final_status = RED_SUCCESS;
+  nodes            = 0;
+
+  if (flags & (BKZ_SD_VARIANT | BKZ_SLD_RED | BKZ_PARALLEL | BKZ_DUMP_GSO | BKZ_ROTATIONS))
+  {
+    throw std::runtime_error("Invalid flags: not supported by the Householder BKZ!");
+  }
+
+  if (param.block_size < 2 || num_rows < 2)
+    return set_status(RED_SUCCESS);
+
+  if (flags & BKZ_VERBOSE)
+  {
+    cerr << "Entering BKZ (Householder):" << endl;
+    cerr << "block size: " << std::setw(3) << param.block_size << ", ";
+    cerr << "flags: 0x" << std::setw(4) << setfill('0') << std::hex << flags << ", " << std::dec
+         << std::setfill(' ');
+    cerr << "max_loops: " << std::setw(3) << param.max_loops << ", ";
+    cerr << "max_time: " << std::setw(0) << std::fixed << std::setprecision(1) << param.max_time
+         << endl
+         << endl;
+  }
+  cputime_start = cputime();
+
+  hlll_prefix(num_rows);
+
+  // same criterion as BKZAutoAbort
+  double old_slope = numeric_limits<double>::max();
+  int no_dec       = -1;
+
+  for (int i = 0;; ++i)
+  {
+    if ((flags & BKZ_MAX_LOOPS) && i >= param.max_loops)
+    {
+      final_status = RED_BKZ_LOOPS_LIMIT;
+      break;
+    }
+    if ((flags & BKZ_MAX_TIME) && (cputime() - cputime_start) * 0.001 >= param.max_time)
+    {
+      final_status = RED_BKZ_TIME_LIMIT;
+      break;
+    }
+    if (flags & BKZ_AUTO_ABORT)
+    {
+      double new_slope = -get_current_slope(0, num_rows);
+      if (no_dec == -1 || new_slope < param.auto_abort_scale * old_slope)
+        no_dec = 0;
+      else
+        no_dec++;
+      old_slope = min(old_slope, new_slope);
+      if (no_dec >= param.auto_abort_max_no_dec)
+        break;
+    }
+    if (control && control->is_cancelled())
+      return set_status(RED_CANCELLED);
+
+    current_tour = i;
+    bool clean;
+    try
+    {
+      clean = tour(i, param, 0, num_rows);
+    }
+    catch (RedStatus &e)
+    {
+      return set_status(e);
+    }
+
+    if (control)
+      control->report_tour(i, get_current_slope(0, num_rows));
+
+    // if we do hkz reduction, we only need one tour
+    if (clean || param.block_size >= num_rows)
+      break;
+  }
+
+  return set_status(final_status);
+}
+
+template <class ZT, class FT>
+double HBKZReduction<ZT, FT>::get_current_slope(int min_row, int max_row)
+{
+  FT f, log_f;
+  long expo;
+  vector<double> x(max_row);
+  for (int i = min_row; i < max_row; i++)
+  {
+    m.get_R(f, i, i, expo);
+    log_f.log(f, GMP_RNDU);
+    x[i] = 2.0 * (log_f.get_d() + expo * std::log(2.0));
+  }
+  int n         = max_row - min_row;
+  double i_mean = (n - 1) * 0.5 + min_row, x_mean = 0, v1 = 0, v2 = 0;
+  for (int i = min_row; i < max_row; i++)
+  {
+    x_mean += x[i];
+  }
+  x_mean /= n;
+  for (int i = min_row; i < max_row; i++)
+  {
+    v1 += (i - i_mean) * (x[i] - x_mean);
+    v2 += (i - i_mean) * (i - i_mean);
+  }
+  return v1 / v2;
+}
+
+template <class ZT, class FT>
+void HBKZReduction<ZT, FT>::print_tour(const int loop, int min_row, int max_row)
+{
+  FT r0;
+  FP_NR<mpfr_t> fr0;
+  long expo;
+  m.get_R(r0, min_row, min_row, expo);
+  r0.mul(r0, r0);
+  fr0 = r0.get_d();
+  fr0.mul_2si(fr0, 2 * expo);
+  cerr << "End of BKZ (Householder) loop " << std::setw(4) << loop << ", time = " << std::fixed
+       << std::setw(9) << std::setprecision(3) << (cputime() - cputime_start) * 0.001 << "s";
+  cerr << ", r_" << min_row << " = " << fr0;
+  cerr << ", slope = " << std::setw(9) << std::setprecision(6)
+       << get_current_slope(min_row, max_row);
+  cerr << ", log2(nodes) = " << std::setw(9) << std::setprecision(6) << log2(nodes) << endl;
+}
+
+template <class ZT, class FT> bool HBKZReduction<ZT, FT>::set_status(int new_status)
+{
+  status = new_status;
+  if (param.flags & BKZ_VERBOSE)
+  {
+    if (status == RED_SUCCESS)
+      cerr << "End of BKZ (Householder): success" << endl;
+    else
+      cerr << "End of BKZ (Householder): failure: " << RED_STATUS_STR[status] << endl;
+  }
+  return status == RED_SUCCESS;
+}
+
+/** enforce instantiation of complete templates **/
+
+template class HBKZReduction<Z_NR<mpz_t>, FP_NR<double>>;
+template class HBKZReduction<Z_NR<long>, FP_NR<double>>;
+
+#ifdef FPLLL_WITH_LONG_DOUBLE
+template class HBKZReduction<Z_NR<mpz_t>, FP_NR<long double>>;
+template class HBKZReduction<Z_NR<long>, FP_NR<long double>>;
+#endif
+
+#ifdef FPLLL_WITH_DPE
+template class HBKZReduction<Z_NR<mpz_t>, FP_NR<dpe_t>>;
+template class HBKZReduction<Z_NR<long>, FP_NR<dpe_t>>;
+#endif
+
+#ifdef FPLLL_WITH_QD
+template class HBKZReduction<Z_NR<mpz_t>, FP_NR<dd_real>>;
+template class HBKZReduction<Z_NR<mpz_t>, FP_NR<qd_real>>;
+template class HBKZReduction<Z_NR<long>, FP_NR<dd_real>>;
+template class HBKZReduction<Z_NR<long>, FP_NR<qd_real>>;
+#endif
+
+template class HBKZReduction<Z_NR<mpz_t>, FP_NR<mpfr_t>>;
+template class HBKZReduction<Z_NR<long>, FP_NR<mpfr_t>>;
+
+FPLLL_END_NAMESPACE
@@ -0,0 +1,122 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef FPLLL_HBKZ_H
+#define FPLLL_HBKZ_H
+
+#include "bkz_param.h"
+#include "hlll.h"
+#include "progress.h"
+
+FPLLL_BEGIN_NAMESPACE
+
+/**
+ * BKZ on the R factor of MatHouseholder (BKZ_METHOD_HOUSEHOLDER).
+ *
+ * The global basis is kept HLLL-reduced by HLLLReduction. Each block is solved on a local copy:
+ * the block of R, R[kappa..kappa+block_size)[kappa..kappa+block_size), is a basis of the
+ * projected block in the coordinates of the Householder vectors. It is scaled and rounded to an
+ * integer matrix, on which the usual svp_reduction (preprocessing, pruned enumeration,
+ * postprocessing) of BKZReduction runs with MatGSO in double precision. The unimodular
+ * transformation found locally is then applied to the rows kappa..kappa+block_size-1 of the
+ * basis and HLLL is restarted from kappa.
+ *
+ * Only the local copies use a Gram-Schmidt orthogonalisation: as for HLLL, the precision needed
+ * on the global basis is the one of Householder QR, which lets large dimensions stay in double
+ * or dd where MatGSO needs mpfr.
+ *
+ * Supported flags: BKZ_VERBOSE, BKZ_MAX_LOOPS, BKZ_MAX_TIME, BKZ_AUTO_ABORT, and the flags used by
+ * svp_reduction (BKZ_BOUNDED_LLL, BKZ_GH_BND). The other variants (BKZ_SD_VARIANT, BKZ_SLD_RED,
+ * BKZ_PARALLEL, BKZ_DUMP_GSO) are rejected.
+ */
+template <class ZT, class FT> class HBKZReduction
+{
+public:
+  /**
+   * @param m
+   *    Householder object of the basis, whose trailing zero rows are ignored
+   * @param hlll_obj
+   *    HLLL object on m, used to keep the basis reduced between blocks
+   * @param param
+   *    parameter object (see bkz_param.h)
+   */
+  HBKZReduction(MatHouseholder<ZT, FT> &m, HLLLReduction<ZT, FT> &hlll_obj, const BKZParam &param);
+
+  /**
+   * @brief SVP-reduce the block [kappa, kappa + block_size).
+   *
+   * @return
+   *    false if it made progress, true otherwise
+   */
+  bool svp_reduction(int kappa, int block_size, const BKZParam &param);
+
+  /**
+   * @brief Runs a BKZ tour from min_row to max_row, finished by an HKZ reduction of the last
+   * block.
+   *
+   * @param loop
+   *    counter indicating the iteration, only for reporting purposes
+   * @return
+   *    false if it made progress, true otherwise
+   */
+  bool tour(const int loop, const BKZParam &param, int min_row, int max_row);
+
+  /**
+   * @brief Runs the main loop of block reduction.
+   *
+   * @return
+   *    true if the reduction was successful, false otherwise.
+   */
+  bool bkz();
+
+  /**
+   * Status of reduction (see defs.h)
+   */
+  int status;
+
+  /**
+      Number of nodes visited during enumeration.
+  */
+  long nodes;
+
+private:
+  // HLLL-reduce the rows [0, end): the rows before n_reduced are kept
+  void hlll_prefix(int end);
+
+  // slope of log(R(i, i)^2) on [min_row, max_row), as MatGSOInterface::get_current_slope
+  double get_current_slope(int min_row, int max_row);
+
+  void print_tour(const int loop, int min_row, int max_row);
+
+  bool set_status(int new_status);
+
+  const BKZParam &param;
+  int num_rows;
+  MatHouseholder<ZT, FT> &m;
+  HLLLReduction<ZT, FT> &hlll_obj;
+
+  // rows [0, n_reduced) are HLLL-reduced and R is known on them
+  int n_reduced;
+
+  double cputime_start;
+
+  // Control attached to the thread when the object was created (see progress.h)
+  ReductionControl *control;
+  int current_tour;
+};
+
+FPLLL_END_NAMESPACE
+
+#endif
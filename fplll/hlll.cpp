@@ -23,7 +23,9 @@
 
 FPLLL_BEGIN_NAMESPACE
 
-template <class ZT, class FT> bool HLLLReduction<ZT, FT>::hlll()
+template <class ZT, class FT> bool HLLLReduction<ZT, FT>::hlll() { return hlll(0, m.get_d()); }
+
+template <class ZT, class FT> bool HLLLReduction<ZT, FT>::hlll(int start, int end)
 {
   /* TODO: we do not use a completely correct value for delta. We must use a value
    * delta_ in (delta + 2^(-p + p0), 1 - 2^(-p + p0)). This implies that, with the
@@ -38,25 +40,38 @@ template <class ZT, class FT> bool HLLLReduction<ZT, FT>::hlll()
   bool status_sr = true;
 
   if (verbose)
-  {
     // Print the parameters of the computation
     print_params();
-    // Discover b[0]
-    cerr << "Discovering vector 1/" << m.get_d() << " cputime=" << cputime() - start_time << endl;
-  }
 
-  // Set R[0] and bf[0] to b[0], precompute ||b[0]||^2
-  m.refresh_R_bf(0);
-  // Compute R[0]
-  m.update_R_last(0);  // In this case, update_R(0) is exactly equal to update_R_last(0)
-  // Precompute dR[0]: R[0]^2 * delta = dR[0] * 2^(2*row_expo[0])
-  compute_dR(0);
-  // Precompute eR[0]: R[0] * eta = eR[0] * 2^row_expo[0]
-  compute_eR(0);
+  // R[start..end) is recomputed
+  m.invalidate_row(start);
+  m.set_updated_R_false();
+
+  int k = start;
+  if (start == 0)
+  {
+    if (verbose)
+    {
+      // Discover b[0]
+      cerr << "Discovering vector 1/" << m.get_d() << " cputime=" << cputime() - start_time
+           << endl;
+    }
+
+    // Set R[0] and bf[0] to b[0], precompute ||b[0]||^2
+    m.refresh_R_bf(0);
+    // Compute R[0]
+    m.update_R_last(0);  // In this case, update_R(0) is exactly equal to update_R_last(0)
+    // Precompute dR[0]: R[0]^2 * delta = dR[0] * 2^(2*row_expo[0])
+    compute_dR(0);
+    // Precompute eR[0]: R[0] * eta = eR[0] * 2^row_expo[0]
+    compute_eR(0);
+
+    k = 1;
+  }
+  // b[0..start) and dR[0..start), eR[0..start) are kept from the previous call otherwise
 
-  int k = 1;
   // Remember which was the largest b[k_max] that is tried to be size-reduced
-  int k_max = 1;
+  int k_max = k;
 
   int prev_k = -1;
   vector<FT> prev_R;
@@ -64,15 +79,22 @@ template <class ZT, class FT> bool HLLLReduction<ZT, FT>::hlll()
   prev_R.resize(m.get_d());
   prev_expo.resize(m.get_d());
   // prev_R[0] is never used: m.get_R(prev_R[0], 0, 0, prev_expo[0]);
+  // The kept rows enter the norm check below when k goes back under start
+  for (int i = 1; i < start; i++)
+    m.get_R(prev_R[i], i, i, prev_expo[i]);
+
+  if (k >= end)
+    return set_status(RED_SUCCESS);
 
   if (verbose)
   {
-    // Discover b[1]
-    cerr << "Discovering vector 2/" << m.get_d() << " cputime=" << cputime() - start_time << endl;
+    // Discover b[k]
+    cerr << "Discovering vector " << k + 1 << "/" << m.get_d()
+         << " cputime=" << cputime() - start_time << endl;
   }
 
-  // Set R[1] and bf[1] to b[1], precompute ||b[1]||^2
-  m.refresh_R_bf(1);
+  // Set R[k] and bf[k] to b[k], precompute ||b[k]||^2
+  m.refresh_R_bf(k);
 
   while (true)
   {
@@ -114,7 +136,7 @@ template <class ZT, class FT> bool HLLLReduction<ZT, FT>::hlll()
       // b[k] is size reduced, now, size reduce b[k + 1]
       k++;
 
-      if (k < m.get_d())
+      if (k < end)
       {
         if (k > k_max)
         {
@@ -135,7 +157,7 @@ template <class ZT, class FT> bool HLLLReduction<ZT, FT>::hlll()
           m.refresh_R(k);
       }
       else
-        // if k == m.get_d(), then b[k] does not exist and the computation is ended
+        // if k == end, then b[k] is not part of the computation and the computation is ended
         return set_status(RED_SUCCESS);
     }
     else
@@ -53,6 +53,14 @@ public:
     */
   bool hlll();
 
+  /**
+    @brief HLLL-reduce b[0..end) when b[0..start) is already HLLL-reduced by a previous call on
+    this object and has not changed since, while b[start..end) may have been modified (for
+    instance by MatHouseholder::apply_transform). Only the rows start..end-1 are rediscovered.
+    R and b are not read beyond end.
+    */
+  bool hlll(int start, int end);
+
   // Get the status of the computation
   inline int get_status() { return status; }
 
@@ -397,6 +397,44 @@ template <class ZT, class FT> void MatHouseholder<ZT, FT>::swap(int i, int j)
 #endif  // DEBUG
 }
 
+template <class ZT, class FT>
+void MatHouseholder<ZT, FT>::apply_transform(const Matrix<ZT> &transform, int src_base)
+{
+  int k = transform.get_rows();
+  FPLLL_DEBUG_CHECK(transform.get_cols() == k && 0 <= src_base && src_base + k <= d);
+  FPLLL_CHECK(!enable_inverse_transform,
+              "MatHouseholder::apply_transform does not support the inverse transform");
+
+  invalidate_row(src_base);
+
+  Matrix<ZT> tmp;
+  for (int pass = 0; pass < (enable_transform ? 2 : 1); pass++)
+  {
+    Matrix<ZT> &a = pass == 0 ? b : u;
+    int cols      = a.get_cols();
+    tmp.resize(k, cols);
+    for (int i = 0; i < k; i++)
+    {
+      tmp[i].fill(0);
+      for (int j = 0; j < k; j++)
+      {
+        if (!transform(i, j).is_zero())
+          tmp[i].addmul(a[src_base + j], transform(i, j), cols);
+      }
+    }
+    for (int i = 0; i < k; i++)
+      for (int j = 0; j < cols; j++)
+        a(src_base + i, j) = tmp(i, j);
+  }
+  for (int i = src_base; i < src_base + k; i++)
+    init_row_size[i] = max(b[i].size_nz(), 1);
+
+#ifdef DEBUG
+  for (int i = src_base; i < src_base + k; i++)
+    col_kept[i] = false;
+#endif  // DEBUG
+}
+
 // Reduce b[k] and R[k] accordingly (Step 3 to Step 6 of Algorithm 3 of [MSV,
 // ISSAC'09])
 template <class ZT, class FT>
@@ -246,6 +246,14 @@ public:
    */
   void swap(int i, int j);
 
+  /**
+   * Replace b[src_base..src_base+k) by transform * b[src_base..src_base+k), where transform is a
+   * k x k integer matrix, and do the same operation on u. R is invalidated from src_base: rows
+   * src_base and above must be refreshed with refresh_R_bf before R is computed again.
+   * Not available if enable_inverse_transform=true.
+   */
+  void apply_transform(const Matrix<ZT> &transform, int src_base);
+
   /**
    * Update n_known_rows to k.
    */
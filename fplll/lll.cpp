@@ -18,6 +18,7 @@
 /* Template source file */
 
 #include "lll.h"
+#include "trace.h"
 #include "util.h"
 
 FPLLL_BEGIN_NAMESPACE
@@ -32,19 +33,31 @@ LLLReduction<ZT, FT>::LLLReduction(MatGSOInterface<ZT, FT> &m, double delta, dou
      NOTE: To make this possible, the hypothesis "g(i, j) is valid if
      0 <= i < n_known_rows and j <= i" in gso.h should be changed and
      MatGSOInterface<ZT, FT>::discover_row() should be rewritten. */
-  enable_early_red = (flags & LLL_EARLY_RED) && !m.enable_int_gram;
-  siegel           = flags & LLL_SIEGEL;
-  verbose          = flags & LLL_VERBOSE;
-  this->delta      = delta;
-  this->eta        = eta;
-  swap_threshold   = siegel ? delta - eta * eta : delta;
-  zeros            = 0;
+  enable_early_red   = (flags & LLL_EARLY_RED) && !m.enable_int_gram;
+  siegel             = flags & LLL_SIEGEL;
+  verbose            = flags & LLL_VERBOSE;
+  this->delta        = delta;
+  this->eta          = eta;
+  swap_threshold     = siegel ? delta - eta * eta : delta;
+  zeros              = 0;
+  control            = get_reduction_control();
+  use_target         = control && control->get_target_norm() > 0 && !(flags & LLL_NO_TARGET);
+  gso_counters_start = m.counters;
+}
+
+template <class ZT, class FT> LLLStats LLLReduction<ZT, FT>::get_stats() const
+{
+  LLLStats result = stats;
+  result.gso      = m.counters;
+  result.gso -= gso_counters_start;
+  return result;
 }
 
 template <class ZT, class FT>
 bool LLLReduction<ZT, FT>::lll(int kappa_min, int kappa_start, int kappa_end,
                                int size_reduction_start)
 {
+  FPLLL_TRACE_ZONE("LLLReduction::lll");
   if (kappa_end == -1)
     kappa_end = m.d;
 
@@ -57,6 +70,7 @@ bool LLLReduction<ZT, FT>::lll(int kappa_min, int kappa_start, int kappa_end,
   zeros       = 0;
   n_swaps     = 0;
   final_kappa = 0;
+  stats.lll_calls++;
   if (verbose)
     print_params();
   extend_vect(lovasz_tests, kappa_end);
@@ -79,8 +93,20 @@ bool LLLReduction<ZT, FT>::lll(int kappa_min, int kappa_start, int kappa_end,
   max_iter = static_cast<long long>(d - 2 * d * (d + 1) *
                                             ((m.get_max_exp_of_b() + 3) / std::log(delta.get_d())));
 
-  for (iter = 0; iter < max_iter && kappa < kappa_end - zeros; iter++)
+  // the vectors before kappa_start are not checked against the target norm
+  bool cancelled = zeros < d && meets_target(kappa_start);
+  for (iter = 0; !cancelled && iter < max_iter && kappa < kappa_end - zeros; iter++)
   {
+    if ((iter & 0x3f) == 0 && control)
+    {
+      if (control->is_cancelled())
+      {
+        cancelled = true;
+        break;
+      }
+      control->report_lll(kappa);
+    }
+
     if (kappa > kappa_max)
     {
       if (verbose)
@@ -108,6 +134,11 @@ bool LLLReduction<ZT, FT>::lll(int kappa_min, int kappa_start, int kappa_end,
 
     // Tests Lovasz's condition
     m.get_gram(lovasz_tests[0], kappa, kappa);
+    if (use_target && meets_target(kappa, lovasz_tests[0]))
+    {
+      cancelled = true;
+      break;
+    }
     for (int i = 1; i <= kappa; i++)
     {
       ftmp1.mul(m.get_mu_exp(kappa, i - 1), m.get_r_exp(kappa, i - 1));
@@ -122,6 +153,7 @@ bool LLLReduction<ZT, FT>::lll(int kappa_min, int kappa_start, int kappa_end,
     if (ftmp1 > lovasz_tests[siegel ? kappa : kappa - 1])
     {
       n_swaps++;
+      stats.swaps++;
       // Failure, computes the insertion index
       int old_k = kappa;
       for (kappa--; kappa > kappa_min; kappa--)
@@ -157,7 +189,12 @@ bool LLLReduction<ZT, FT>::lll(int kappa_min, int kappa_start, int kappa_end,
   if (m.enable_int_gram)
     m.symmetrize_g();
 
-  if (kappa < kappa_end - zeros)
+  if (cancelled)
+  {
+    final_kappa = kappa;
+    return set_status(RED_CANCELLED);
+  }
+  else if (kappa < kappa_end - zeros)
     return set_status(RED_LLL_FAILURE);
   else
     return set_status(RED_SUCCESS);
@@ -184,6 +221,10 @@ bool LLLReduction<ZT, FT>::babai(int kappa, int size_reduction_end, int size_red
     if (!loop_needed)
       break;
 
+    stats.size_reduction_iterations++;
+    if (iter > 0)
+      stats.babai_restarts++;
+
     if (iter >= 2)
     {
       long new_max_expo = m.get_max_mu_exp(kappa, size_reduction_end);
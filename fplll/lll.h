@@ -20,6 +20,7 @@
 
 #include "gso.h"
 #include "gso_interface.h"
+#include "progress.h"
 
 FPLLL_BEGIN_NAMESPACE
 
@@ -67,6 +68,28 @@ public:
 
   inline bool size_reduction(int kappa_min = 0, int kappa_end = -1, int size_reduction_start = 0);
 
+  /**
+     @brief Counters accumulated since the object was created.
+
+     The row operation counters include all the operations performed on `m` since then, also
+     by callers other than this object. Times are left at zero (see Wrapper).
+  */
+
+  LLLStats get_stats() const;
+
+  /**
+     @brief Checks b_kappa against the target norm of the control attached to the thread when the
+     object was created (see ReductionControl::set_target_norm).
+
+     lll() checks each vector it size-reduces. This is for callers which insert vectors without
+     calling lll() afterwards. Always false with the flag LLL_NO_TARGET.
+
+     @param kappa index of the vector, its Gram-Schmidt row must be up to date
+     @return true if b_kappa meets the target, the control then requests the reduction to stop
+  */
+
+  inline bool meets_target(int kappa);
+
   int status;
   int final_kappa;
   int last_early_red;
@@ -87,6 +110,7 @@ private:
   inline bool early_reduction(int start, int size_reduction_start = 0);
   inline void print_params();
   inline bool set_status(int new_status);
+  inline bool meets_target(int kappa, const FT &sq_norm);
 
   MatGSOInterface<ZT, FT> &m;
   FT delta, eta, swap_threshold;
@@ -94,12 +118,20 @@ private:
   bool enable_early_red;
   bool siegel;
   bool verbose;
+  bool use_target;
+
+  // Control attached to the thread when the object was created (see progress.h)
+  ReductionControl *control;
+
+  // Counters, without those of m (see get_stats)
+  LLLStats stats;
+  GSOCounters gso_counters_start;
 
   vector<FT> lovasz_tests;
   vector<FT> babai_mu;
   vector<long> babai_expo;
   ZT ztmp1;
-  FT mu_m_ant, ftmp1;
+  FT mu_m_ant, ftmp1, target_tmp;
 };
 
 template <class ZT, class FT>
@@ -165,6 +197,24 @@ template <class ZT, class FT> inline bool LLLReduction<ZT, FT>::set_status(int n
   return status == RED_SUCCESS;
 }
 
+template <class ZT, class FT> inline bool LLLReduction<ZT, FT>::meets_target(int kappa)
+{
+  if (!use_target)
+    return false;
+  m.get_gram(target_tmp, kappa, kappa);
+  return meets_target(kappa, target_tmp);
+}
+
+/* sq_norm is the squared norm of b_kappa scaled as the Gram matrix of m */
+template <class ZT, class FT>
+inline bool LLLReduction<ZT, FT>::meets_target(int kappa, const FT &sq_norm)
+{
+  target_tmp = sq_norm;
+  if (m.enable_row_expo)
+    target_tmp.mul_2si(target_tmp, 2 * m.row_expo[kappa]);
+  return control->check_target(target_tmp.get_d());
+}
+
 FPLLL_END_NAMESPACE
 
 #endif
@@ -30,6 +30,14 @@ template <class ZT> int lll(Options &o, ZZ_mat<ZT> &b)
     flags |= LLL_EARLY_RED;
   if (o.siegel)
     flags |= LLL_SIEGEL;
+  if (o.gso_window)
+    flags |= LLL_GSO_WINDOW;
+  if (o.predict_prec)
+    flags |= LLL_PREDICT_PREC;
+  if (o.qary)
+    flags |= LLL_QARY;
+  if (o.decompose)
+    flags |= LLL_DECOMPOSE;
 
   if (strchr(format, 'v') != NULL)
   {
@@ -139,6 +147,10 @@ template <> int bkz(Options &o, ZZ_mat<mpz_t> &b)
 
   param.delta = o.delta;
   param.flags = o.bkz_flags;
+  if (o.qary)
+    param.flags |= BKZ_QARY;
+  if (o.decompose)
+    param.flags |= BKZ_DECOMPOSE;
 
   if (o.bkz_flags & BKZ_DUMP_GSO)
     param.dump_gso_filename = o.bkz_dump_gso_filename;
@@ -148,6 +160,11 @@ template <> int bkz(Options &o, ZZ_mat<mpz_t> &b)
     param.max_loops = o.bkz_max_loops;
   if (o.bkz_flags & BKZ_MAX_TIME)
     param.max_time = o.bkz_max_time;
+  if (o.bkz_flags & BKZ_PARALLEL)
+    param.parallel_blocks = o.bkz_parallel_blocks;
+  if (o.bkz_flags & BKZ_ROTATIONS)
+    param.rotation_degree = o.bkz_rotation_degree;
+  param.method = o.bkz_method;
   if (o.verbose)
     param.flags |= BKZ_VERBOSE;
   if (o.no_lll)
@@ -537,6 +554,35 @@ void read_options(int argc, char **argv, Options &o)
     {
       o.bkz_flags |= BKZ_BOUNDED_LLL;
     }
+    else if (strcmp(argv[ac], "-bkzlocalpreproc") == 0)
+    {
+      o.bkz_flags |= BKZ_LOCAL_PREPROC;
+    }
+    else if (strcmp(argv[ac], "-bkzparallel") == 0)
+    {
+      ++ac;
+      CHECK(ac < argc, "missing value after '-bkzparallel'");
+      o.bkz_parallel_blocks = atoi(argv[ac]);
+      o.bkz_flags |= BKZ_PARALLEL;
+    }
+    else if (strcmp(argv[ac], "-bkzrotations") == 0)
+    {
+      ++ac;
+      CHECK(ac < argc, "missing value after '-bkzrotations'");
+      o.bkz_rotation_degree = atoi(argv[ac]);
+      o.bkz_flags |= BKZ_ROTATIONS;
+    }
+    else if (strcmp(argv[ac], "-bkzmethod") == 0)
+    {
+      ++ac;
+      CHECK(ac < argc, "missing value after '-bkzmethod'");
+      if (strcmp("gso", argv[ac]) == 0)
+        o.bkz_method = BKZ_METHOD_GSO;
+      else if (strcmp("householder", argv[ac]) == 0)
+        o.bkz_method = BKZ_METHOD_HOUSEHOLDER;
+      else
+        ABORT_MSG("parse error in -bkzmethod switch : gso or householder expected");
+    }
     else if (strcmp(argv[ac], "-bkzmaxloops") == 0)
     {
       ++ac;
@@ -662,6 +708,18 @@ void read_options(int argc, char **argv, Options &o)
       CHECK(ac < argc, "missing value after -p switch");
       o.precision = atoi(argv[ac]);
     }
+    else if (strcmp(argv[ac], "-threads") == 0)
+    {
+      ++ac;
+      CHECK(ac < argc, "missing value after -threads switch");
+      o.threads = atoi(argv[ac]);
+    }
+    else if (strcmp(argv[ac], "-affinity") == 0)
+    {
+      ++ac;
+      CHECK(ac < argc, "missing value after -affinity switch");
+      o.affinity = argv[ac];
+    }
     else if (strcmp(argv[ac], "-v") == 0)
     {
       o.verbose = true;
@@ -670,6 +728,22 @@ void read_options(int argc, char **argv, Options &o)
     {
       o.early_red = true;
     }
+    else if (strcmp(argv[ac], "-gsowindow") == 0)
+    {
+      o.gso_window = true;
+    }
+    else if (strcmp(argv[ac], "-predprec") == 0)
+    {
+      o.predict_prec = true;
+    }
+    else if (strcmp(argv[ac], "-qary") == 0)
+    {
+      o.qary = true;
+    }
+    else if (strcmp(argv[ac], "-decompose") == 0)
+    {
+      o.decompose = true;
+    }
     else if (strcmp(argv[ac], "-z") == 0)
     {
       ++ac;
@@ -721,6 +795,14 @@ void read_options(int argc, char **argv, Options &o)
            << "       LLL version (default: wrapper)\n"
            << "  -y\n"
            << "       Enable early reduction\n"
+           << "  -gsowindow\n"
+           << "       Only keep a window of rows of the floating-point Gram matrix\n"
+           << "  -predprec\n"
+           << "       Choose the floating-point type from a predicted precision\n"
+           << "  -qary\n"
+           << "       Reduce q-ary bases [I | H; 0 | qI] modulo q first (with the wrapper)\n"
+           << "  -decompose\n"
+           << "       Reduce the orthogonal components of the basis independently first\n"
 
            << "  -b <block_size>\n"
            << "       Size of BKZ blocks\n"
@@ -736,11 +818,25 @@ void read_options(int argc, char **argv, Options &o)
            << "        Multiplies the Gaussian heuristic by <factor> (of float type)\n"
            << "  -bkzboundedlll\n"
            << "        Restricts the LLL call\n"
+           << "  -bkzlocalpreproc\n"
+           << "        Preprocesses blocks on a local copy of the projected block\n"
+           << "  -bkzparallel <blocks>\n"
+           << "        Reduces disjoint blocks concurrently, <blocks> at a time (0 = automatic)\n"
+           << "  -bkzrotations <degree>\n"
+           << "        Inserts the rotations of new short vectors, for lattices closed under the\n"
+           << "        cyclic shift of blocks of <degree> coordinates (0 = half the dimension)\n"
+           << "  -bkzmethod [gso|householder]\n"
+           << "        Orthogonalisation used by BKZ (default: gso)\n"
            << "  -bkzdumpgso <file_name>\n"
            << "        Dumps the log of the Gram-Schmidt vectors in specified file\n"
            << "  -of [b|c|s|t|u|v|bk|uk|vk]\n"
            << "        Output formats.\n"
 
+           << "  -threads <threads>\n"
+           << "        Number of threads for parallel enumeration (default=1, -1 = all cores)\n"
+           << "  -affinity [none|compact|scatter|<cpu list>]\n"
+           << "        Pin threads to CPUs (e.g. -affinity 0,2,4-7). Overrides FPLLL_AFFINITY\n"
+
            << "Please refer to https://github.com/fplll/fplll/README.md for more information.\n";
       exit(0);
     }
@@ -774,6 +870,10 @@ int main(int argc, char **argv)
   int result;
   Options o;
   read_options(argc, argv, o);
+  set_threads(o.threads);
+  if (o.affinity)
+    CHECK(set_thread_affinity(string(o.affinity)) >= 0,
+          "parse error in -affinity switch : none, compact, scatter or a cpu list expected");
   ZZ_mat<mpz_t>::set_print_mode(MAT_PRINT_REGULAR);
   switch (o.int_type)
   {
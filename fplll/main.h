@@ -49,12 +49,16 @@ struct Options
   Options()
       : action(ACTION_LLL), method(LM_WRAPPER), int_type(ZT_MPZ), float_type(FT_DEFAULT),
         delta(LLL_DEF_DELTA), eta(LLL_DEF_ETA), precision(0), early_red(false), siegel(false),
-        no_lll(false), block_size(0), bkz_gh_factor(1.1), verbose(false), input_file(NULL),
-        output_format(NULL), theta(HLLL_DEF_THETA), c(HLLL_DEF_C)
+        gso_window(false), predict_prec(false), qary(false), decompose(false), no_lll(false),
+        block_size(0), bkz_gh_factor(1.1), verbose(false), input_file(NULL), output_format(NULL),
+        theta(HLLL_DEF_THETA), c(HLLL_DEF_C), threads(1), affinity(NULL)
   {
-    bkz_flags     = 0;
-    bkz_max_loops = 0;
-    bkz_max_time  = 0;
+    bkz_flags           = 0;
+    bkz_max_loops       = 0;
+    bkz_max_time        = 0;
+    bkz_parallel_blocks = 0;
+    bkz_rotation_degree = 0;
+    bkz_method          = BKZ_METHOD_GSO;
   }
   Action action;
   LLLMethod method;
@@ -65,6 +69,10 @@ struct Options
   int precision;
   bool early_red;
   bool siegel;
+  bool gso_window;
+  bool predict_prec;
+  bool qary;
+  bool decompose;
 
   bool no_lll;
   int block_size;
@@ -78,6 +86,9 @@ struct Options
   string bkz_dump_gso_filename;
   double bkz_gh_factor;
   string bkz_strategy_file;
+  int bkz_parallel_blocks;
+  int bkz_rotation_degree;
+  BKZMethod bkz_method;
 
   bool verbose;
   const char *input_file;
@@ -85,6 +96,9 @@ struct Options
 
   double theta;
   double c;
+
+  int threads;
+  const char *affinity;
 };
 
 #endif
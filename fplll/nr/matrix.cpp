@@ -51,6 +51,44 @@ template <class T> void Matrix<T>::resize(int rows, int cols)
   cols = c;
 }
 
+template <class T> void Matrix<T>::resize_triangular(int rows, bool store_new_rows)
+{
+  int old_size = matrix.size();
+  if (old_size < rows)
+  {
+    vector<NumVect<T>> m2(max(old_size * 2, rows));
+    for (int i = 0; i < old_size; i++)
+    {
+      matrix[i].swap(m2[i]);
+    }
+    matrix.swap(m2);
+  }
+  for (int i = store_new_rows ? 0 : r; i < rows; i++)
+  {
+    store_triangular_row(i, store_new_rows);
+  }
+  r = rows;
+  c = rows;
+}
+
+template <class T> void Matrix<T>::rotate_triangular_left(int first, int last)
+{
+  rotate_left(first, last);
+  for (int i = first; i <= last; i++)
+  {
+    matrix[i].resize(i + 1);
+  }
+}
+
+template <class T> void Matrix<T>::rotate_triangular_right(int first, int last)
+{
+  rotate_right(first, last);
+  for (int i = first; i <= last; i++)
+  {
+    matrix[i].resize(i + 1);
+  }
+}
+
 template <class T> template <class U> void Matrix<T>::fill(U value)
 {
   for (int i = 0; i < r; i++)
@@ -62,9 +100,35 @@ template <class T> template <class U> void Matrix<T>::fill(U value)
   }
 }
 
+template <class T> bool Matrix<T>::drop_gram_rows(int first, int last)
+{
+  bool drop = false;
+  for (int i = first; i <= last && !drop; i++)
+    drop = !is_row_stored(i);
+  if (drop)
+  {
+    for (int i = first; i <= last; i++)
+      store_triangular_row(i, false);
+  }
+  return drop;
+}
+
 template <class T> void Matrix<T>::rotate_gram_left(int first, int last, int n_valid_rows)
 {
   FPLLL_DEBUG_CHECK(0 <= first && first <= last && last < n_valid_rows && n_valid_rows <= r);
+  // With triangular storage, row first is extended to hold the new row last
+  bool triangular = matrix[first].size() <= last;
+  if (triangular && drop_gram_rows(first, last))
+  {
+    for (int i = last + 1; i < n_valid_rows; i++)
+    {
+      if (is_row_stored(i))
+        matrix[i].rotate_left(first, last);
+    }
+    return;
+  }
+  if (triangular)
+    matrix[first].resize(last + 1);
   matrix[first][first].swap(matrix[first][last]);
   for (int i = first; i < last; i++)
   {
@@ -72,24 +136,48 @@ template <class T> void Matrix<T>::rotate_gram_left(int first, int last, int n_v
   }
   for (int i = first; i < n_valid_rows; i++)
   {
-    matrix[i].rotate_left(first, min(last, i));  // most expensive step
+    if (is_row_stored(i))
+      matrix[i].rotate_left(first, min(last, i));  // most expensive step
   }
-  rotate_left(first, last);
+  if (triangular)
+    rotate_triangular_left(first, last);
+  else
+    rotate_left(first, last);
 }
 
 template <class T> void Matrix<T>::rotate_gram_right(int first, int last, int n_valid_rows)
 {
   FPLLL_DEBUG_CHECK(0 <= first && first <= last && last < n_valid_rows && n_valid_rows <= r);
+  // With triangular storage, the rows which move down get one more element, which comes to
+  // column first below, and the row last is only cut once it has been used as row first
+  bool triangular = matrix[first].size() <= last;
+  if (triangular && drop_gram_rows(first, last))
+  {
+    for (int i = last + 1; i < n_valid_rows; i++)
+    {
+      if (is_row_stored(i))
+        matrix[i].rotate_right(first, last);
+    }
+    return;
+  }
   rotate_right(first, last);
+  if (triangular)
+  {
+    for (int i = first + 1; i <= last; i++)
+      matrix[i].resize(i + 1);
+  }
   for (int i = first; i < n_valid_rows; i++)
   {
-    matrix[i].rotate_right(first, min(last, i));  // most expensive step
+    if (is_row_stored(i))
+      matrix[i].rotate_right(first, min(last, i));  // most expensive step
   }
   for (int i = first; i < last; i++)
   {
     matrix[i + 1][first].swap(matrix[first][i]);
   }
   matrix[first][first].swap(matrix[first][last]);
+  if (triangular)
+    matrix[first].resize(first + 1);
 }
 
 template <class T> void Matrix<T>::transpose()
@@ -116,7 +204,7 @@ template <class T> T Matrix<T>::get_max()
   T m, a;
   m = 0.0;
   for (int i = 0; i < r; i++)
-    for (int j = 0; j < c; j++)
+    for (int j = 0; j < min(c, matrix[i].size()); j++)
     {
       a.abs(matrix[i][j]);
       m = max(m, a);
@@ -128,7 +216,7 @@ template <class T> long Matrix<T>::get_max_exp()
 {
   long max_exp = 0;
   for (int i = 0; i < r; i++)
-    for (int j = 0; j < c; j++)
+    for (int j = 0; j < min(c, matrix[i].size()); j++)
       max_exp = max(max_exp, matrix[i][j].exponent());
   return max_exp;
 }
@@ -145,7 +233,8 @@ template <class T> void Matrix<T>::print(ostream &os, int nrows, int ncols) cons
     if (i > 0)
       os << '\n';
     os << '[';
-    for (int j = 0; j < ncols; j++)
+    // a triangular matrix only prints its stored elements
+    for (int j = 0; j < min(ncols, matrix[i].size()); j++)
     {
       if (j > 0)
         os << ' ';
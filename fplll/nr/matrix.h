@@ -134,6 +134,23 @@ public:
   /** Sets the dimensions of this matrix, preserving as much as possible of the
       content. The value of new elements is undefined. */
   void resize(int rows, int cols);
+  /** Sets the dimensions of this matrix to rows x rows and only stores its lower triangle: row i
+      keeps its first i + 1 elements. The stored content is preserved. Such a matrix is permuted
+      with rotate_triangular_left/right or rotate_gram_left/right, which keep this shape.
+      If store_new_rows=false, the existing rows are kept as they are and the new ones are left
+      out (see store_triangular_row). */
+  void resize_triangular(int rows, bool store_new_rows = true);
+  /** Stores row i of a triangular matrix with i + 1 undefined elements if stored=true, or leaves
+      it out and frees its elements otherwise. A left-out row has size 0. */
+  void store_triangular_row(int i, bool stored)
+  {
+    if (stored)
+      matrix[i].resize(i + 1);
+    else
+      NumVect<T>().swap(matrix[i]);
+  }
+  /** Returns false if row i of a triangular matrix is left out. */
+  bool is_row_stored(int i) const { return matrix[i].size() > 0; }
   /** Sets the number of rows. Content is not erased except for deleted rows.
       The value of new elements is undefined. */
   void set_rows(int rows) { resize(rows, c); }
@@ -191,11 +208,20 @@ public:
       (m[first],...,m[middle-1],m[middle],m[last]) becomes
       (m[middle],...,m[last],m[first],...,m[middle-1]) */
   void rotate(int first, int middle, int last) { rotate_by_swap(matrix, first, middle, last); }
+  /** rotate_left(first, last) on a matrix created by resize_triangular. The rows which move are
+      cut or extended to the length of their new position, new elements are undefined. */
+  void rotate_triangular_left(int first, int last);
+  /** rotate_right(first, last) on a matrix created by resize_triangular, see
+      rotate_triangular_left. */
+  void rotate_triangular_right(int first, int last);
   /** Transformation needed to update the lower triangular Gram matrix when
-     rotate_left(first, last) is done on the basis of the lattice. */
+     rotate_left(first, last) is done on the basis of the lattice. It also applies to a Gram
+     matrix created by resize_triangular: left-out rows stay out, and the rows first to last are
+     all left out if one of them is. */
   void rotate_gram_left(int first, int last, int n_valid_rows);
   /** Transformation needed to update the lower triangular Gram matrix when
-      rotate_right(first, last) is done on the basis of the lattice. */
+      rotate_right(first, last) is done on the basis of the lattice. It also applies to a Gram
+      matrix created by resize_triangular, see rotate_gram_left. */
   void rotate_gram_right(int first, int last, int n_valid_rows);
   /** Transpose. */
   void transpose();
@@ -219,6 +245,9 @@ public:
   }
 
 protected:
+  // Leaves out the rows first to last of a triangular Gram matrix if one of them is left out
+  bool drop_gram_rows(int first, int last);
+
   int r, c;
   vector<NumVect<T>> matrix;
 
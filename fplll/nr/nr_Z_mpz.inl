@@ -201,7 +201,7 @@ template <> inline void Z_NR<mpz_t>::randb(int bits)
   if (bits > 32)
   {
     unsigned long long tmp = static_cast<unsigned long long>(mpz_get_ui(data) & ~((1ULL) << 31));
-    gmp_randseed_ui(RandGen::gmp_state, tmp * tmp);
+    gmp_randseed_ui(RandGen::get_gmp_state(), tmp * tmp);
   }
 }
 
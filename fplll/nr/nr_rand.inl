@@ -37,14 +37,27 @@ public:
   static bool get_initialized() { return initialized; }
   static gmp_randstate_t &get_gmp_state()
   {
+    if (local_state != nullptr)
+      return *local_state;
     if (!initialized)
       init();
     return gmp_state;
   }
   static gmp_randstate_t gmp_state;
 
+  /* state used by the calling thread instead of gmp_state (nullptr: use gmp_state), set while a
+     ReductionContext is attached to the thread (see context.h); returns the previous one */
+  static gmp_randstate_t *set_local_state(gmp_randstate_t *state)
+  {
+    gmp_randstate_t *old = local_state;
+    local_state          = state;
+    return old;
+  }
+  static gmp_randstate_t *get_local_state() { return local_state; }
+
 private:
   static bool initialized;
+  static thread_local gmp_randstate_t *local_state;
 };
 
 class RandGenInt
@@ -55,17 +68,27 @@ public:
     initialized = true;
     srand(time(NULL));
   }
+  // rand() is shared by the whole process, a thread with a local state of RandGen uses it instead
   static int get()
   {
+    if (RandGen::get_local_state() != nullptr)
+      return gmp_urandomb_ui(*RandGen::get_local_state(), 31);
     if (!initialized)
       init();
     return rand();
   }
   static int get_bit()
   {
-    if (!initialized)
-      init();
-    if (rand() % 2 == 0)
+    int r;
+    if (RandGen::get_local_state() != nullptr)
+      r = gmp_urandomb_ui(*RandGen::get_local_state(), 1);
+    else
+    {
+      if (!initialized)
+        init();
+      r = rand();
+    }
+    if (r % 2 == 0)
       return -1;
     else
       return 1;
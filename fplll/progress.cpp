@@ -0,0 +1,94 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "progress.h"
+
+FPLLL_BEGIN_NAMESPACE
+
+static thread_local ReductionControl *current_control = nullptr;
+
+ReductionControl *get_reduction_control() { return current_control; }
+
+ReductionControlScope::ReductionControlScope(ReductionControl *control) : previous(current_control)
+{
+  current_control = control;
+}
+
+ReductionControlScope::~ReductionControlScope() { current_control = previous; }
+
+void ReductionControl::report_lll(int kappa)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    // LLL calls made by BKZ (preprocessing) do not change the stage
+    if (progress.stage != STAGE_BKZ)
+    {
+      progress.stage = STAGE_LLL;
+      progress.kappa = kappa;
+    }
+  }
+  notify(false);
+}
+
+void ReductionControl::report_bkz(int kappa, int tour)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    progress.stage = STAGE_BKZ;
+    progress.kappa = kappa;
+    progress.tour  = tour;
+  }
+  notify(false);
+}
+
+void ReductionControl::report_tour(int tour, double slope)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    progress.stage = STAGE_BKZ;
+    progress.tour  = tour;
+    progress.slope = slope;
+  }
+  notify(true);
+}
+
+void ReductionControl::report_nodes(uint64_t new_nodes)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (progress.stage == STAGE_NONE || progress.stage == STAGE_LLL)
+      progress.stage = STAGE_ENUM;
+    progress.nodes += new_nodes;
+  }
+  notify(false);
+}
+
+void ReductionControl::notify(bool force)
+{
+  if (!callback)
+    return;
+  auto now = std::chrono::steady_clock::now();
+  ReductionProgress snapshot;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!force && now - last_callback < std::chrono::milliseconds(interval))
+      return;
+    last_callback = now;
+    snapshot      = progress;
+  }
+  callback(snapshot);
+}
+
+FPLLL_END_NAMESPACE
@@ -0,0 +1,166 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef FPLLL_PROGRESS_H
+#define FPLLL_PROGRESS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fplll/defs.h>
+#include <functional>
+#include <mutex>
+
+FPLLL_BEGIN_NAMESPACE
+
+enum ReductionStage
+{
+  STAGE_NONE = 0,
+  STAGE_LLL  = 1,
+  STAGE_BKZ  = 2,
+  STAGE_ENUM = 3
+};
+
+const char *const REDUCTION_STAGE_STR[4] = {"none", "lll", "bkz", "enum"};
+
+/**
+ * @brief Snapshot of the progress of a running reduction.
+ */
+struct ReductionProgress
+{
+  ReductionProgress() : stage(STAGE_NONE), kappa(-1), tour(-1), slope(0.0), nodes(0) {}
+
+  /** algorithm currently running **/
+  ReductionStage stage;
+  /** current index in LLL, or start of the current block in BKZ **/
+  int kappa;
+  /** index of the current BKZ tour **/
+  int tour;
+  /** slope of the log of the Gram-Schmidt norms at the end of the last BKZ tour **/
+  double slope;
+  /** number of enumeration nodes visited so far **/
+  uint64_t nodes;
+};
+
+/**
+   @brief Callback function used by ReductionControl.
+*/
+typedef void(reduction_progress_callback)(const ReductionProgress &progress);
+
+/**
+ * @brief Progress reporting and cooperative cancellation of a reduction.
+ *
+ * A control is attached to the calling thread with ReductionControlScope. While it is attached,
+ * LLLReduction, BKZReduction and the enumeration report their progress to it and regularly check
+ * whether cancel() was called. A cancelled reduction stops as soon as possible, leaves a valid
+ * (but not fully reduced) basis behind and returns RED_CANCELLED.
+ *
+ * The progress can be polled with get_progress() from any thread. If a callback is given, it is
+ * called from the reducing thread at the end of each BKZ tour and at most every `interval`
+ * milliseconds otherwise.
+ *
+ * With a target norm (see set_target_norm), LLLReduction checks each vector it size-reduces and
+ * BKZReduction each vector it inserts, and the reduction stops as if cancelled once a basis vector
+ * meets the target. lll_reduction, bkz_reduction and hkz_reduction then return RED_TARGET_REACHED
+ * and get_target_index() gives the row of the basis holding that vector.
+ */
+class ReductionControl
+{
+public:
+  ReductionControl(std::function<reduction_progress_callback> callback = nullptr,
+                   int interval                                        = 100)
+      : callback(callback), interval(interval), cancelled(false), target_norm(0.0),
+        target_reached(false), target_index(-1), last_callback(std::chrono::steady_clock::now())
+  {
+  }
+
+  /** request the cancellation of the reduction, may be called from any thread **/
+  void cancel() { cancelled.store(true); }
+
+  inline bool is_cancelled() const { return cancelled.load(std::memory_order_relaxed); }
+
+  /** stop the reduction once a nonzero basis vector has squared norm at most `sq_norm`, 0 (the
+      default) disables the target; must be set before the reduction starts **/
+  void set_target_norm(double sq_norm) { target_norm = sq_norm; }
+
+  inline double get_target_norm() const { return target_norm; }
+
+  /** true if the reduction was stopped by the target norm **/
+  inline bool is_target_reached() const { return target_reached.load(); }
+
+  /** row of the basis meeting the target norm, -1 if it was not reached **/
+  int get_target_index() const { return target_index.load(); }
+
+  ReductionProgress get_progress() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return progress;
+  }
+
+  /* reporting interface for the reduction algorithms */
+  void report_lll(int kappa);
+  void report_bkz(int kappa, int tour);
+  void report_tour(int tour, double slope);
+  void report_nodes(uint64_t new_nodes);
+
+  /* returns true and requests the reduction to stop if a basis vector of squared norm `sq_norm`
+     meets the target norm */
+  inline bool check_target(double sq_norm)
+  {
+    if (!(sq_norm > 0 && sq_norm <= target_norm))
+      return false;
+    target_reached.store(true);
+    cancelled.store(true);
+    return true;
+  }
+
+  /* set by lll_reduction, bkz_reduction and hkz_reduction once the reduction stopped */
+  void set_target_index(int i) { target_index.store(i); }
+
+private:
+  void notify(bool force);
+
+  std::function<reduction_progress_callback> callback;
+  int interval;
+  std::atomic<bool> cancelled;
+  double target_norm;
+  std::atomic<bool> target_reached;
+  std::atomic<int> target_index;
+  mutable std::mutex mutex;
+  ReductionProgress progress;
+  std::chrono::steady_clock::time_point last_callback;
+};
+
+/**
+ * @brief Control attached to the calling thread, or nullptr if there is none.
+ */
+ReductionControl *get_reduction_control();
+
+/**
+ * @brief Attaches a control to the calling thread for the lifetime of this object.
+ */
+class ReductionControlScope
+{
+public:
+  ReductionControlScope(ReductionControl *control);
+  ~ReductionControlScope();
+
+private:
+  ReductionControl *previous;
+};
+
+FPLLL_END_NAMESPACE
+
+#endif
@@ -149,6 +149,7 @@ void Pruner<FT>::optimize_coefficients_cost_fixed_prob(/*io*/ vector<double> &pr
  */
 template <class FT> void Pruner<FT>::optimize_coefficients(/*io*/ vector<double> &pr)
 {
+  FPLLL_TRACE_ZONE("Pruner::optimize_coefficients");
   if (opt_single)
   {
     optimize_coefficients_cost_fixed_prob(pr);
@@ -77,7 +77,17 @@ static bool enumerate_svp(int d, MatGSOInterface<Z_NR<mpz_t>, FP_NR<mpfr_t>> &gs
 {
   Enumeration<Z_NR<mpz_t>, FP_NR<mpfr_t>> enumobj(gso, evaluator);
   bool dual = (flags & SVP_DUAL);
+  if (flags & SVP_VERBOSE)
+  {
+    EnumerationEstimate estimate = enumobj.estimate_nodes(0, d, max_dist, 0, pruning, dual);
+    cout << "estimated nodes = " << estimate.nodes << " (standard error " << estimate.error
+         << ")" << endl;
+  }
   enumobj.enumerate(0, d, max_dist, 0, vector<FP_NR<mpfr_t>>(), vector<enumxt>(), pruning, dual);
+  if (flags & SVP_VERBOSE)
+  {
+    cout << "nodes = " << enumobj.get_nodes() << endl;
+  }
   return !evaluator.empty();
 }
 
@@ -194,6 +204,11 @@ static int shortest_vector_ex(ZZ_mat<mpz_t> &b, vector<Z_NR<mpz_t>> &sol_coord,
     }
     result = RED_SUCCESS;
   }
+  // a cancelled enumeration may have missed the shortest vector, the best vector found so far is
+  // still returned
+  ReductionControl *control = get_reduction_control();
+  if (control && control->is_cancelled())
+    result = RED_CANCELLED;
 
   if (findsubsols)
   {
@@ -389,6 +404,11 @@ static int shortest_vector_ex(
     }
     result = RED_SUCCESS;
   }
+  // a cancelled enumeration may have missed the shortest vector, the best vector found so far is
+  // still returned
+  ReductionControl *control = get_reduction_control();
+  if (control && control->is_cancelled())
+    result = RED_CANCELLED;
 
   if (findsubsols)
   {
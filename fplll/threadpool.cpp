@@ -15,12 +15,322 @@
 
 #include <fplll/threadpool.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#define FPLLL_WITH_AFFINITY 1
+#endif
+
 FPLLL_BEGIN_NAMESPACE
 
 thread_pool::thread_pool threadpool;
 
+static thread_local thread_pool::thread_pool *local_threadpool = nullptr;
+
+thread_pool::thread_pool &get_threadpool()
+{
+  return local_threadpool != nullptr ? *local_threadpool : threadpool;
+}
+
+thread_pool::thread_pool *set_local_threadpool(thread_pool::thread_pool *pool)
+{
+  thread_pool::thread_pool *old = local_threadpool;
+  local_threadpool              = pool;
+  return old;
+}
+
+static ThreadAffinity affinity_policy = AFFINITY_NONE;
+static std::vector<int> affinity_list;
+static bool affinity_env_read = false;
+
+static std::atomic<uint64_t> stat_pinned_threads(0);
+static std::atomic<uint64_t> stat_pin_failures(0);
+static std::atomic<uint64_t> stat_jobs(0);
+static std::atomic<uint64_t> stat_migrations(0);
+static std::atomic<uint64_t> stat_node_migrations(0);
+
+/* parse a Linux style CPU list such as "0-3,8,10-11", returns false on a parse error */
+static bool parse_cpu_list(const std::string &str, std::vector<int> &cpus)
+{
+  std::istringstream is(str);
+  std::string item;
+  cpus.clear();
+  while (std::getline(is, item, ','))
+  {
+    if (item.empty() || item == "\n")
+      continue;
+    char *end;
+    long lo = strtol(item.c_str(), &end, 10), hi = lo;
+    if (end == item.c_str() || lo < 0)
+      return false;
+    if (*end == '-')
+    {
+      const char *p = end + 1;
+      hi            = strtol(p, &end, 10);
+      if (end == p || hi < lo)
+        return false;
+    }
+    if (*end != '\0' && *end != '\n')
+      return false;
+    for (long c = lo; c <= hi; ++c)
+      cpus.push_back(int(c));
+  }
+  return !cpus.empty();
+}
+
+/* NUMA node of every CPU as listed in sysfs; CPUs without a node are considered on node 0 */
+static std::map<int, int> read_numa_nodes()
+{
+  std::map<int, int> nodes;
+#ifdef FPLLL_WITH_AFFINITY
+  for (int node = 0; node < 1024; ++node)
+  {
+    std::ifstream f("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    if (!f)
+    {
+      // node ids may be sparse, but do not keep probing when there is no NUMA information
+      if (node >= 64 && nodes.empty())
+        break;
+      continue;
+    }
+    std::string line;
+    std::vector<int> cpus;
+    if (std::getline(f, line) && parse_cpu_list(line, cpus))
+      for (int cpu : cpus)
+        nodes[cpu] = node;
+  }
+#endif
+  return nodes;
+}
+
+/* CPUs the process may run on */
+static std::vector<int> read_allowed_cpus()
+{
+  std::vector<int> cpus;
+#ifdef FPLLL_WITH_AFFINITY
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+      if (CPU_ISSET(cpu, &set))
+        cpus.push_back(cpu);
+#endif
+  if (cpus.empty())
+    for (int cpu = 0; cpu < int(std::max(1u, std::thread::hardware_concurrency())); ++cpu)
+      cpus.push_back(cpu);
+  return cpus;
+}
+
+static const std::map<int, int> &numa_nodes()
+{
+  static const std::map<int, int> nodes = read_numa_nodes();
+  return nodes;
+}
+
+/* the first call must happen before any of our threads is pinned */
+static const std::vector<int> &allowed_cpus()
+{
+  static const std::vector<int> cpus = read_allowed_cpus();
+  return cpus;
+}
+
+int current_cpu()
+{
+#ifdef FPLLL_WITH_AFFINITY
+  return sched_getcpu();
+#else
+  return -1;
+#endif
+}
+
+int cpu_numa_node(int cpu)
+{
+  if (cpu < 0)
+    return -1;
+  const std::map<int, int> &nodes = numa_nodes();
+  auto it                         = nodes.find(cpu);
+  return it == nodes.end() ? 0 : it->second;
+}
+
+/* placement list: slot i of the threadpool is pinned to placement[i % placement.size()] */
+static std::vector<int> affinity_placement()
+{
+  std::vector<int> placement;
+  const std::vector<int> &allowed = allowed_cpus();
+  switch (affinity_policy)
+  {
+  case AFFINITY_COMPACT:
+    placement = allowed;
+    std::stable_sort(placement.begin(), placement.end(),
+                     [](int a, int b) { return cpu_numa_node(a) < cpu_numa_node(b); });
+    break;
+  case AFFINITY_SCATTER:
+  {
+    std::map<int, std::vector<int>> per_node;
+    for (int cpu : allowed)
+      per_node[cpu_numa_node(cpu)].push_back(cpu);
+    for (std::size_t i = 0; placement.size() < allowed.size(); ++i)
+      for (auto &node : per_node)
+        if (i < node.second.size())
+          placement.push_back(node.second[i]);
+    break;
+  }
+  case AFFINITY_LIST:
+    placement = affinity_list;
+    break;
+  default:
+    break;
+  }
+  return placement;
+}
+
+static bool pin_current_thread(int cpu)
+{
+#ifdef FPLLL_WITH_AFFINITY
+  if (cpu >= 0 && cpu < CPU_SETSIZE)
+  {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0)
+    {
+      ++stat_pinned_threads;
+      return true;
+    }
+  }
+#endif
+  ++stat_pin_failures;
+  return false;
+}
+
+/* allow the calling thread to run on all CPUs of the process again */
+static void unpin_current_thread()
+{
+#ifdef FPLLL_WITH_AFFINITY
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : allowed_cpus())
+    if (cpu < CPU_SETSIZE)
+      CPU_SET(cpu, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
+/* run one job on every thread of the threadpool (including the main thread) that pins the thread
+   to its slot; the barrier ensures every thread takes exactly one job */
+static int apply_affinity()
+{
+  const std::vector<int> placement = affinity_placement();
+  const int threads                = threadpool.size() + 1;
+  const std::thread::id main_id    = std::this_thread::get_id();
+  std::atomic<int> next_slot(1), pinned(0);
+  barrier all_started(threads);
+  threadpool.run(
+      [&]() {
+        int slot = (std::this_thread::get_id() == main_id) ? 0 : next_slot++;
+        if (placement.empty())
+          unpin_current_thread();
+        else if (pin_current_thread(placement[slot % placement.size()]))
+          ++pinned;
+        all_started.wait();
+      },
+      threads);
+  return pinned;
+}
+
+static void read_affinity_env()
+{
+  affinity_env_read = true;
+  const char *spec  = getenv("FPLLL_AFFINITY");
+  if (spec != nullptr && *spec != '\0' && set_thread_affinity(std::string(spec)) < 0)
+    cerr << "fplll: ignoring invalid FPLLL_AFFINITY value '" << spec << "'" << endl;
+}
+
+int set_thread_affinity(ThreadAffinity policy, const std::vector<int> &cpus)
+{
+  affinity_env_read = true;
+  allowed_cpus();
+  affinity_policy = policy;
+  affinity_list   = (policy == AFFINITY_LIST) ? cpus : std::vector<int>();
+  if (policy == AFFINITY_LIST && affinity_list.empty())
+    affinity_policy = AFFINITY_NONE;
+  return apply_affinity();
+}
+
+int set_thread_affinity(const std::string &spec)
+{
+  if (spec == "none")
+    return set_thread_affinity(AFFINITY_NONE);
+  if (spec == "compact")
+    return set_thread_affinity(AFFINITY_COMPACT);
+  if (spec == "scatter")
+    return set_thread_affinity(AFFINITY_SCATTER);
+  std::vector<int> cpus;
+  if (!parse_cpu_list(spec, cpus))
+    return -1;
+  return set_thread_affinity(AFFINITY_LIST, cpus);
+}
+
+ThreadAffinity get_thread_affinity() { return affinity_policy; }
+
+AffinityStats get_affinity_stats()
+{
+  AffinityStats stats;
+  stats.pinned_threads  = stat_pinned_threads;
+  stats.pin_failures    = stat_pin_failures;
+  stats.jobs            = stat_jobs;
+  stats.migrations      = stat_migrations;
+  stats.node_migrations = stat_node_migrations;
+  return stats;
+}
+
+void reset_affinity_stats()
+{
+  stat_pinned_threads  = 0;
+  stat_pin_failures    = 0;
+  stat_jobs            = 0;
+  stat_migrations      = 0;
+  stat_node_migrations = 0;
+}
+
+int affinity_job_begin() { return current_cpu(); }
+
+void affinity_job_end(int start_cpu)
+{
+  ++stat_jobs;
+  int cpu = current_cpu();
+  if (start_cpu < 0 || cpu < 0 || cpu == start_cpu)
+    return;
+  ++stat_migrations;
+  if (cpu_numa_node(cpu) != cpu_numa_node(start_cpu))
+    ++stat_node_migrations;
+}
+
 /* get and set number of threads in threadpool, both return the (new) number of threads */
-int get_threads() { return threadpool.size() + 1; }
+int get_threads() { return get_threadpool().size() + 1; }
+
+static thread_local int enumeration_threads_cap = 0;
+
+int get_enumeration_threads()
+{
+  int th = get_threads();
+  return (enumeration_threads_cap > 0 && enumeration_threads_cap < th) ? enumeration_threads_cap
+                                                                         : th;
+}
+
+int set_enumeration_threads(int th)
+{
+  int old                 = enumeration_threads_cap;
+  enumeration_threads_cap = th < 0 ? 0 : th;
+  return old;
+}
 
 int set_threads(int th)
 {
@@ -28,7 +338,24 @@ int set_threads(int th)
     th = std::thread::hardware_concurrency();
   if (th < 1)
     th = 1;
-  threadpool.resize(th - 1);
+  if (local_threadpool != nullptr)
+  {
+    local_threadpool->resize(th - 1);
+    return get_threads();
+  }
+  if (!affinity_env_read)
+  {
+    // capture the process affinity mask before any of our threads is pinned
+    allowed_cpus();
+    threadpool.resize(th - 1);
+    read_affinity_env();
+  }
+  else
+  {
+    threadpool.resize(th - 1);
+    if (affinity_policy != AFFINITY_NONE)
+      apply_affinity();
+  }
   return get_threads();
 }
 
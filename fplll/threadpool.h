@@ -18,6 +18,8 @@
 
 #include <fplll/defs.h>
 #include <fplll/io/thread_pool.hpp>
+#include <string>
+#include <vector>
 
 FPLLL_BEGIN_NAMESPACE
 
@@ -62,10 +64,92 @@ typedef thread_pool::barrier barrier;
 
 extern thread_pool::thread_pool threadpool;
 
-/* get and set number of threads in threadpool, both return the (new) number of threads */
+/* threadpool used by the calling thread: the one of the ReductionContext attached to the thread
+   (see context.h) or the global threadpool above. set_local_threadpool sets the threadpool of the
+   calling thread (nullptr: use the global one) and returns the previous one. */
+thread_pool::thread_pool &get_threadpool();
+thread_pool::thread_pool *set_local_threadpool(thread_pool::thread_pool *pool);
+
+/* get and set number of threads in the threadpool of the calling thread, both return the (new)
+   number of threads */
 int get_threads();
 int set_threads(int th = -1);  // -1 defaults number of threads to machine's number of cores
 
+/* number of threads used by a parallel enumeration started from the calling thread
+
+        This is get_threads() unless the calling thread set a lower cap. With a cap of 1 the
+   enumeration runs in the calling thread without using the threadpool: this is how several
+   enumerations run concurrently (see BKZ_PARALLEL), since only one thread at a time may wait for
+   the jobs of the threadpool. set_enumeration_threads returns the previous cap, 0 means no cap. */
+int get_enumeration_threads();
+int set_enumeration_threads(int th = 0);
+
+/* thread placement
+
+        The main thread is slot 0 and pooled thread i is slot i+1. Each slot is pinned to one CPU
+   taken from a placement list built according to the policy:
+
+        AFFINITY_NONE     do not pin, leave placement to the OS scheduler (default)
+        AFFINITY_COMPACT  fill the CPUs of the first NUMA node before moving to the next one
+        AFFINITY_SCATTER  round-robin over NUMA nodes, so consecutive slots land on different nodes
+        AFFINITY_LIST     use an explicit list of CPU ids
+
+        Placement only applies to the global threadpool. Only CPUs in the affinity mask of the process
+   at the time of the first call are used. The
+   policy is re-applied by set_threads(), so pooled threads created later are pinned as well. Since
+   a pinned thread first-touches its own stack, per-thread state copied by a job (e.g. enumlib's
+   lattice_enum_t) ends up on the local NUMA node.
+
+        If set_thread_affinity() is never called, the policy is read from the environment variable
+   FPLLL_AFFINITY (same syntax as the string version below) on the first call to set_threads().
+
+        Pinning is only supported on Linux. Elsewhere set_thread_affinity() accepts the policy but
+   does not pin any thread, which is reflected in the pin_failures counter.
+*/
+enum ThreadAffinity
+{
+  AFFINITY_NONE    = 0,
+  AFFINITY_COMPACT = 1,
+  AFFINITY_SCATTER = 2,
+  AFFINITY_LIST    = 3
+};
+
+/* set the placement policy and pin all current threads, returns the number of pinned threads */
+int set_thread_affinity(ThreadAffinity policy, const std::vector<int> &cpus = std::vector<int>());
+/* parse "none", "compact", "scatter" or a CPU list such as "0,2,4-7", returns the number of pinned
+   threads or -1 on a parse error */
+int set_thread_affinity(const std::string &spec);
+ThreadAffinity get_thread_affinity();
+
+/* counters showing the effect of thread placement
+
+        pinned_threads   threads successfully pinned since the last reset
+        pin_failures     threads that could not be pinned
+        jobs             jobs that reported their placement via affinity_job_end()
+        migrations       jobs that finished on another CPU than they started on
+        node_migrations  jobs that finished on another NUMA node than they started on
+*/
+struct AffinityStats
+{
+  uint64_t pinned_threads;
+  uint64_t pin_failures;
+  uint64_t jobs;
+  uint64_t migrations;
+  uint64_t node_migrations;
+};
+
+AffinityStats get_affinity_stats();
+void reset_affinity_stats();
+
+/* CPU the calling thread runs on and the NUMA node of a CPU, -1 when unknown */
+int current_cpu();
+int cpu_numa_node(int cpu);
+
+/* bookkeeping for long running jobs: call affinity_job_begin() at the start of a job and pass its
+   return value to affinity_job_end() at the end to update the migration counters */
+int affinity_job_begin();
+void affinity_job_end(int start_cpu);
+
 FPLLL_END_NAMESPACE
 
 #endif
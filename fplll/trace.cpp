@@ -0,0 +1,177 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "trace.h"
+
+#ifdef FPLLL_WITH_TRACING
+
+#include "io/json.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unistd.h>
+#include <vector>
+
+using json = nlohmann::json;
+
+FPLLL_BEGIN_NAMESPACE
+
+std::atomic<bool> trace_recording(false);
+
+struct TraceEvent
+{
+  const char *name;
+  std::chrono::steady_clock::time_point start, end;
+};
+
+/* Zones recorded by one thread. Buffers are owned by the registry and outlive their thread, so
+   that zones of finished threads are still written. */
+struct TraceBuffer
+{
+  int tid;
+  std::vector<TraceEvent> events;
+};
+
+struct TraceRegistry
+{
+  std::mutex mutex;
+  std::vector<std::unique_ptr<TraceBuffer>> buffers;
+  std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+static TraceRegistry &trace_registry()
+{
+  static TraceRegistry *registry = new TraceRegistry();  // never destroyed, see trace_at_exit
+  return *registry;
+}
+
+static TraceBuffer &trace_buffer()
+{
+  thread_local TraceBuffer *buffer = nullptr;
+  if (buffer == nullptr)
+  {
+    TraceRegistry &registry = trace_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.buffers.emplace_back(new TraceBuffer());
+    buffer      = registry.buffers.back().get();
+    buffer->tid = static_cast<int>(registry.buffers.size());
+  }
+  return *buffer;
+}
+
+void trace_record(const char *name, std::chrono::steady_clock::time_point start,
+                  std::chrono::steady_clock::time_point end)
+{
+  TraceEvent event = {name, start, end};
+  trace_buffer().events.push_back(event);
+}
+
+bool trace_start()
+{
+  trace_registry();
+  trace_recording = true;
+  return true;
+}
+
+void trace_stop() { trace_recording = false; }
+
+void trace_clear()
+{
+  TraceRegistry &registry = trace_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto &buffer : registry.buffers)
+    buffer->events.clear();
+  registry.epoch = std::chrono::steady_clock::now();
+}
+
+bool trace_write(const std::string &filename)
+{
+  TraceRegistry &registry = trace_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  int pid           = static_cast<int>(getpid());
+  json events       = json::array();
+  auto microseconds = [&registry](std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration<double, std::micro>(t - registry.epoch).count();
+  };
+
+  for (auto &buffer : registry.buffers)
+  {
+    events.push_back({{"name", "thread_name"},
+                      {"ph", "M"},
+                      {"pid", pid},
+                      {"tid", buffer->tid},
+                      {"args", {{"name", "fplll thread " + std::to_string(buffer->tid)}}}});
+    for (const TraceEvent &event : buffer->events)
+    {
+      events.push_back({{"name", event.name},
+                        {"cat", "fplll"},
+                        {"ph", "X"},
+                        {"pid", pid},
+                        {"tid", buffer->tid},
+                        {"ts", microseconds(event.start)},
+                        {"dur", microseconds(event.end) - microseconds(event.start)}});
+    }
+  }
+
+  std::ofstream os(filename);
+  if (!os)
+    return false;
+  os << json({{"traceEvents", events}, {"displayTimeUnit", "ms"}}) << endl;
+  return static_cast<bool>(os);
+}
+
+/* FPLLL_TRACE=<file>: record from library load to program exit */
+
+static std::string trace_env_filename;
+
+static void trace_at_exit()
+{
+  trace_stop();
+  if (!trace_write(trace_env_filename))
+    cerr << "fplll: cannot write trace to '" << trace_env_filename << "'" << endl;
+}
+
+static struct TraceEnv
+{
+  TraceEnv()
+  {
+    const char *filename = getenv("FPLLL_TRACE");
+    if (filename == nullptr || *filename == '\0')
+      return;
+    trace_env_filename = filename;
+    trace_start();
+    atexit(trace_at_exit);
+  }
+} trace_env;
+
+FPLLL_END_NAMESPACE
+
+#else
+
+FPLLL_BEGIN_NAMESPACE
+
+bool trace_start() { return false; }
+
+void trace_stop() {}
+
+void trace_clear() {}
+
+bool trace_write(const std::string &) { return false; }
+
+FPLLL_END_NAMESPACE
+
+#endif
@@ -0,0 +1,136 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef FPLLL_TRACE_H
+#define FPLLL_TRACE_H
+
+#include <fplll/defs.h>
+#include <string>
+
+#ifdef FPLLL_WITH_TRACING
+#include <atomic>
+#include <chrono>
+#endif
+
+FPLLL_BEGIN_NAMESPACE
+
+/**
+ * Tracing zones.
+ *
+ * When fplll is configured with --enable-tracing, the main steps of the reductions (LLL calls of
+ * the wrapper, BKZ preprocessing, SVP reduction and postprocessing, pruning optimisation and
+ * enumeration, including the enumlib worker threads) are marked with FPLLL_TRACE_ZONE. While
+ * recording, every zone entered by any thread is stored in a buffer of this thread and the
+ * timeline can be written as a Chrome trace (chrome://tracing, Perfetto) with one track per
+ * thread.
+ *
+ * Recording can also be enabled without changing the program by setting the environment
+ * variable FPLLL_TRACE to a file name: recording then starts when the library is loaded and the
+ * trace is written to this file when the program exits.
+ *
+ * Without --enable-tracing, FPLLL_TRACE_ZONE expands to nothing and the functions below do
+ * nothing and return false.
+ */
+
+/**
+   @brief Start recording tracing zones.
+
+   @return false if fplll was built without tracing support
+*/
+
+bool trace_start();
+
+/**
+   @brief Stop recording tracing zones. Recorded zones are kept.
+*/
+
+void trace_stop();
+
+/**
+   @brief Discard all recorded zones.
+
+   Must not be called while zones are being recorded by other threads.
+*/
+
+void trace_clear();
+
+/**
+   @brief Write the recorded zones as a Chrome trace JSON file.
+
+   Must not be called while zones are being recorded by other threads.
+
+   @param filename output file
+   @return false if fplll was built without tracing support or the file cannot be written
+*/
+
+bool trace_write(const std::string &filename);
+
+#ifdef FPLLL_WITH_TRACING
+
+extern std::atomic<bool> trace_recording;
+
+/**
+   @brief Add a zone to the buffer of the calling thread.
+
+   @param name  static string naming the zone
+   @param start start time of the zone
+   @param end   end time of the zone
+*/
+
+void trace_record(const char *name, std::chrono::steady_clock::time_point start,
+                  std::chrono::steady_clock::time_point end);
+
+/**
+ * @brief Records the lifetime of the object as a zone (see FPLLL_TRACE_ZONE).
+ */
+class TraceZone
+{
+public:
+  explicit TraceZone(const char *name)
+      : name(name), recording(trace_recording.load(std::memory_order_relaxed))
+  {
+    if (recording)
+      start = std::chrono::steady_clock::now();
+  }
+
+  ~TraceZone()
+  {
+    if (recording)
+      trace_record(name, start, std::chrono::steady_clock::now());
+  }
+
+  TraceZone(const TraceZone &) = delete;
+  TraceZone &operator=(const TraceZone &) = delete;
+
+private:
+  const char *name;
+  bool recording;
+  std::chrono::steady_clock::time_point start;
+};
+
+#define FPLLL_TRACE_ZONE_CAT_(a, b) a##b
+#define FPLLL_TRACE_ZONE_CAT(a, b) FPLLL_TRACE_ZONE_CAT_(a, b)
+#define FPLLL_TRACE_ZONE(name)                                                                     \
+  ::fplll::TraceZone FPLLL_TRACE_ZONE_CAT(fplll_trace_zone_, __LINE__)(name)
+
+#else
+
+#define FPLLL_TRACE_ZONE(name)
+
+#endif
+
+FPLLL_END_NAMESPACE
+
+#endif
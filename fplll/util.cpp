@@ -14,6 +14,7 @@
    along with fplll. If not, see <http://www.gnu.org/licenses/>. */
 
 #include "util.h"
+#include "progress.h"
 
 #ifdef DEBUG
 int debug_depth = 0;
@@ -38,6 +39,7 @@ bool LDConvHelper::temp_initialized = false;
    one source file) */
 bool RandGen::initialized = false;
 gmp_randstate_t RandGen::gmp_state;
+thread_local gmp_randstate_t *RandGen::local_state = nullptr;
 
 static int compute_min_prec(double &rho, int d, double delta, double eta, double epsilon,
                             MinPrecAlgo algo)
@@ -284,17 +286,47 @@ template <class ZT> void zeros_last(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_
   }
 }
 
+template <class ZT> int target_status(ZZ_mat<ZT> &b, int status)
+{
+  ReductionControl *control = get_reduction_control();
+  if (status != RED_CANCELLED || !control || !control->is_target_reached())
+    return status;
+
+  // The rows have moved since the test (zero rows, conversions), so the vector is searched for.
+  // The test was done in floating-point: if no row passes the exact test, the shortest one is
+  // reported.
+  int index        = -1;
+  double best_norm = 0.0;
+  Z_NR<ZT> norm;
+  for (int i = 0; i < b.get_rows(); i++)
+  {
+    b[i].dot_product(norm, b[i]);
+    double x = norm.get_d();
+    if (x == 0.0 || (index >= 0 && x >= best_norm))
+      continue;
+    index     = i;
+    best_norm = x;
+    if (x <= control->get_target_norm())
+      break;
+  }
+  control->set_target_index(index);
+  return RED_TARGET_REACHED;
+}
+
 template void zeros_first<mpz_t>(ZZ_mat<mpz_t> &, ZZ_mat<mpz_t> &, ZZ_mat<mpz_t> &);
 template void zeros_last<mpz_t>(ZZ_mat<mpz_t> &, ZZ_mat<mpz_t> &, ZZ_mat<mpz_t> &);
+template int target_status<mpz_t>(ZZ_mat<mpz_t> &, int);
 
 #ifdef FPLLL_WITH_ZLONG
 template void zeros_first<long>(ZZ_mat<long> &, ZZ_mat<long> &, ZZ_mat<long> &);
 template void zeros_last<long>(ZZ_mat<long> &, ZZ_mat<long> &, ZZ_mat<long> &);
+template int target_status<long>(ZZ_mat<long> &, int);
 #endif
 
 #ifdef FPLLL_WITH_ZDOUBLE
 template void zeros_first<double>(ZZ_mat<double> &, ZZ_mat<double> &, ZZ_mat<double> &);
 template void zeros_last<double>(ZZ_mat<double> &, ZZ_mat<double> &, ZZ_mat<double> &);
+template int target_status<double>(ZZ_mat<double> &, int);
 #endif
 
 FPLLL_END_NAMESPACE
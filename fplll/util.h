@@ -97,6 +97,13 @@ template <class ZT> void zeros_first(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u
 
 template <class ZT> void zeros_last(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv_t);
 
+/**
+ * Final status of a reduction of b which returned `status`. If the control attached to the calling
+ * thread stopped the reduction because a vector met its target norm, stores the row of b holding
+ * that vector in the control and returns RED_TARGET_REACHED.
+ */
+template <class ZT> int target_status(ZZ_mat<ZT> &b, int status);
+
 /**
  * Returns the string corresponding to an error code of LLL/BKZ.
  */
@@ -0,0 +1,318 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "verify.h"
+#include "context.h"
+#include "threadpool.h"
+#include "util.h"
+#include <atomic>
+#include <thread>
+
+FPLLL_BEGIN_NAMESPACE
+
+/* Calls f(0), ..., f(n - 1) from the threads of the threadpool. The rows are handed out in
+   increasing order, so f(i) may wait for the end of f(j) for j < i. */
+template <class FT> static void parallel_rows(int n, const std::function<void(int)> &f)
+{
+  int n_jobs = std::min(get_threads(), n);
+  if (n_jobs <= 1)
+  {
+    for (int i = 0; i < n; i++)
+      f(i);
+    return;
+  }
+  std::atomic<int> next(0);
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  unsigned int prec         = FT::get_prec();
+  ReductionContext *context = get_reduction_context();
+  auto job                  = [&]() {
+    ReductionContextScope context_scope(context);
+    unsigned int old_prec = FT::set_prec(prec);
+    try
+    {
+      for (int i = next++; i < n; i = next++)
+        f(i);
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      error = std::current_exception();
+    }
+    FT::set_prec(old_prec);
+  };
+  thread_pool::thread_pool &pool = get_threadpool();
+  for (int j = 0; j < n_jobs; ++j)
+    pool.push(job);
+  pool.wait_work();
+  if (error)
+    std::rethrow_exception(error);
+}
+
+/* Cholesky factorization of the Gram matrix g with error bounds, in FT with precision p. For
+   j <= i, r(i, j) = g(i, j) - sum_(k < j) mu(j, k) * r(i, k) and mu(i, j) = r(i, j) / r(j, j), as
+   in MatGSOInterface::update_gso_row.
+
+   All the error bounds are non-negative and each update of a bound is multiplied by
+   up = 1 + 2^(4 - p), which covers the rounding errors of the few operations of the update. A
+   lower bound is multiplied by down = 1 - 2^(4 - p) instead.
+
+   The conditions of row i are checked if check[i] is set and the result is stored in status[i].
+   A row is broken when one of the r(j, j) it depends on cannot be certified positive, its
+   conditions are then inconclusive. */
+template <class FT>
+static void certified_check(Matrix<Z_NR<mpz_t>> &g, int n, double delta, double eta,
+                            double theta, const vector<char> &check, vector<int> &status)
+{
+  int prec = FT::get_prec();
+  FT u, up, down, delta_f, eta_f, theta_f;
+  u = 1.0;
+  u.mul_2si(u, -prec);
+  up.mul_2si(u, 4);
+  down = 1.0;
+  down.sub(down, up);
+  up.add(up, 1.0);
+  delta_f = delta;
+  eta_f   = eta;
+  theta_f = theta;
+
+  vector<vector<FT>> mu(n), mu_err(n);
+  vector<FT> r_diag(n), r_err(n);
+  vector<char> broken(n, 0);
+  vector<std::atomic<int>> done(n);
+  for (int i = 0; i < n; i++)
+  {
+    mu[i].resize(i);
+    mu_err[i].resize(i);
+    done[i].store(0);
+  }
+
+  auto row = [&](int i) {
+    vector<FT> r_row(i + 1), r_row_err(i + 1);
+    FT s, e, t, ftmp1, ftmp2;
+    bool row_broken = false;
+
+    for (int j = 0; j <= i && !row_broken; j++)
+    {
+      if (j < i)
+      {
+        while (!done[j].load(std::memory_order_acquire))
+          std::this_thread::yield();
+        if (broken[j])
+        {
+          row_broken = true;
+          break;
+        }
+      }
+      // the conversion of an mpz_t to a double truncates, its error is at most 2u
+      s.set_z(g(i, j));
+      e.abs(s);
+      e.mul(e, u);
+      e.mul_2si(e, 1);
+      for (int k = 0; k < j; k++)
+      {
+        t.mul(mu[j][k], r_row[k]);
+        s.sub(s, t);
+        // |mu(j, k)| * err(r(i, k)) + |r(i, k)| * err(mu(j, k)) + err(mu(j, k)) * err(r(i, k))
+        ftmp1.abs(mu[j][k]);
+        ftmp1.add(ftmp1, mu_err[j][k]);
+        ftmp1.mul(ftmp1, r_row_err[k]);
+        ftmp2.abs(r_row[k]);
+        ftmp1.addmul(ftmp2, mu_err[j][k]);
+        // rounding errors of the product and of the subtraction
+        t.abs(t);
+        ftmp2.abs(s);
+        t.add(t, ftmp2);
+        ftmp1.addmul(t, u);
+        e.add(e, ftmp1);
+        e.mul(e, up);
+      }
+      if (!s.is_finite() || !e.is_finite())
+      {
+        row_broken = true;
+        break;
+      }
+      r_row[j]     = s;
+      r_row_err[j] = e;
+      if (j == i)
+        break;
+
+      // |r(i, j) / r(j, j) - r~(i, j) / r~(j, j)| <= (err(r(i, j)) + |mu~(i, j)| * err(r(j, j)))
+      //                                              / (r~(j, j) - err(r(j, j)))
+      mu[i][j].div(s, r_diag[j]);
+      ftmp1.sub(r_diag[j], r_err[j]);
+      ftmp1.mul(ftmp1, down);
+      ftmp2.abs(mu[i][j]);
+      t.mul(ftmp2, r_err[j]);
+      t.add(t, e);
+      t.div(t, ftmp1);
+      t.addmul(ftmp2, u);
+      mu_err[i][j].mul(t, up);
+    }
+
+    // the later rows need r(i, i) > 0, but a failure of the Lovász condition may still be certain
+    bool diag_ok = false;
+    if (!row_broken)
+    {
+      r_diag[i] = r_row[i];
+      r_err[i]  = r_row_err[i];
+      ftmp1.sub(r_diag[i], r_err[i]);
+      diag_ok = ftmp1 > 0.0;
+    }
+    broken[i] = row_broken || !diag_ok;
+
+    if (check[i])
+    {
+      int st = LLL_VERIFY_REDUCED;
+      if (row_broken || (i == 0 && !diag_ok))
+        st = LLL_VERIFY_INCONCLUSIVE;
+      for (int j = 0; j < i && !row_broken; j++)
+      {
+        // bounds on the size-reduction bound eta + theta * sqrt(r(i, i) / r(j, j))
+        FT bound_lo = eta_f, bound_hi = eta_f;
+        if (theta > 0)
+        {
+          // eta is a lower bound as long as r(i, i) is not certified positive
+          if (diag_ok)
+          {
+            ftmp1.sub(r_diag[i], r_err[i]);
+            ftmp2.add(r_diag[j], r_err[j]);
+            ftmp1.div(ftmp1, ftmp2);
+            ftmp1.sqrt(ftmp1);
+            ftmp1.mul(ftmp1, down);
+            bound_lo.addmul(ftmp1, theta_f);
+            bound_lo.mul(bound_lo, down);
+          }
+          ftmp1.add(r_diag[i], r_err[i]);
+          ftmp2.sub(r_diag[j], r_err[j]);
+          ftmp1.div(ftmp1, ftmp2);
+          ftmp1.sqrt(ftmp1);
+          ftmp1.mul(ftmp1, up);
+          bound_hi.addmul(ftmp1, theta_f);
+          bound_hi.mul(bound_hi, up);
+        }
+        ftmp1.abs(mu[i][j]);
+        ftmp2.sub(ftmp1, mu_err[i][j]);
+        ftmp2.mul(ftmp2, down);
+        ftmp1.add(ftmp1, mu_err[i][j]);
+        ftmp1.mul(ftmp1, up);
+        if (ftmp2 > bound_hi)
+          st = LLL_VERIFY_NOT_REDUCED;
+        else if (ftmp1 > bound_lo && st == LLL_VERIFY_REDUCED)
+          st = LLL_VERIFY_INCONCLUSIVE;
+        if (st == LLL_VERIFY_NOT_REDUCED)
+          break;
+      }
+      if (i > 0 && st != LLL_VERIFY_NOT_REDUCED && !row_broken)
+      {
+        // L = r(i, i) - q * r(i - 1, i - 1) with q = delta - mu(i, i - 1)^2, the error of L is
+        // at most err(r(i, i)) + |q| * err(r(i - 1, i - 1))
+        //          + (2 |mu| err(mu) + err(mu)^2) * (r(i - 1, i - 1) + err(r(i - 1, i - 1)))
+        //          + u * (|r(i, i)| + 3 |q * r(i - 1, i - 1)|)
+        FT q, l, l_err;
+        const FT &m = mu[i][i - 1], &m_err = mu_err[i][i - 1];
+        q.mul(m, m);
+        q.sub(delta_f, q);
+        t.mul(q, r_diag[i - 1]);
+        l.sub(r_diag[i], t);
+        t.abs(t);
+        ftmp1.abs(q);
+        l_err.mul(ftmp1, r_err[i - 1]);
+        l_err.add(l_err, r_err[i]);
+        ftmp1.abs(m);
+        ftmp1.mul_2si(ftmp1, 1);
+        ftmp1.add(ftmp1, m_err);
+        ftmp1.mul(ftmp1, m_err);
+        ftmp2.add(r_diag[i - 1], r_err[i - 1]);
+        l_err.addmul(ftmp1, ftmp2);
+        ftmp1.mul_d(t, 3.0);
+        ftmp2.abs(r_diag[i]);
+        ftmp1.add(ftmp1, ftmp2);
+        l_err.addmul(ftmp1, u);
+        l_err.mul(l_err, up);
+        ftmp1.add(l, l_err);
+        ftmp2.sub(l, l_err);
+        if (ftmp1 < 0.0)
+          st = LLL_VERIFY_NOT_REDUCED;
+        else if (ftmp2 < 0.0 || !diag_ok)
+          st = LLL_VERIFY_INCONCLUSIVE;
+      }
+      status[i] = st;
+    }
+    done[i].store(1, std::memory_order_release);
+  };
+
+  parallel_rows<FT>(n, row);
+}
+
+LLLVerifyResult verify_lll_reduced(ZZ_mat<mpz_t> &b, double delta, double eta, double theta,
+                                   int max_prec)
+{
+  int d = b.get_rows(), n = b.get_cols();
+  LLLVerifyResult result;
+  result.precision = 53;
+  if (max_prec <= 0)
+    max_prec = max(106, l2_min_prec(d, delta, eta, LLL_DEF_EPSILON));
+
+  // exact Gram matrix
+  Matrix<Z_NR<mpz_t>> g;
+  g.resize_triangular(d);
+  parallel_rows<FP_NR<double>>(d, [&](int i) {
+    for (int j = 0; j <= i; j++)
+      b[i].dot_product(g(i, j), b[j], n);
+  });
+
+  vector<int> status(d, LLL_VERIFY_REDUCED);
+  vector<char> check(d, 1);
+  certified_check<FP_NR<double>>(g, d, delta, eta, theta, check, status);
+
+  for (int prec = 2 * result.precision; result.precision < max_prec; prec *= 2)
+  {
+    int last = 0;
+    for (int i = 0; i < d; i++)
+    {
+      check[i] = status[i] == LLL_VERIFY_INCONCLUSIVE;
+      if (check[i])
+      {
+        last = i + 1;
+        if (result.precision == 53)
+          result.escalated_rows.push_back(i);
+      }
+    }
+    if (last == 0)
+      break;
+    result.precision      = min(prec, max_prec);
+    unsigned int old_prec = FP_NR<mpfr_t>::set_prec(result.precision);
+    certified_check<FP_NR<mpfr_t>>(g, last, delta, eta, theta, check, status);
+    FP_NR<mpfr_t>::set_prec(old_prec);
+  }
+
+  for (int i = 0; i < d; i++)
+  {
+    if (status[i] == LLL_VERIFY_NOT_REDUCED)
+      result.failed_rows.push_back(i);
+    else if (status[i] == LLL_VERIFY_INCONCLUSIVE)
+      result.inconclusive_rows.push_back(i);
+  }
+  if (!result.failed_rows.empty())
+    result.status = LLL_VERIFY_NOT_REDUCED;
+  else if (!result.inconclusive_rows.empty())
+    result.status = LLL_VERIFY_INCONCLUSIVE;
+  else
+    result.status = LLL_VERIFY_REDUCED;
+  return result;
+}
+
+FPLLL_END_NAMESPACE
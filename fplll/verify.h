@@ -0,0 +1,86 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef FPLLL_VERIFY_H
+#define FPLLL_VERIFY_H
+
+#include "nr/matrix.h"
+
+FPLLL_BEGIN_NAMESPACE
+
+enum LLLVerifyStatus
+{
+  LLL_VERIFY_REDUCED      = 0,
+  LLL_VERIFY_NOT_REDUCED  = 1,
+  LLL_VERIFY_INCONCLUSIVE = 2
+};
+
+/**
+ * @brief Result of verify_lll_reduced.
+ */
+struct LLLVerifyResult
+{
+  /** LLL_VERIFY_NOT_REDUCED if some row certainly fails, otherwise LLL_VERIFY_INCONCLUSIVE if some
+      row could not be decided, otherwise LLL_VERIFY_REDUCED **/
+  int status;
+  /** rows i such that b_i is certainly not size-reduced or the Lovász condition between b_(i-1)
+      and b_i certainly fails **/
+  vector<int> failed_rows;
+  /** rows which could not be decided at the highest precision **/
+  vector<int> inconclusive_rows;
+  /** rows which could not be decided in double and were checked again at a higher precision **/
+  vector<int> escalated_rows;
+  /** highest precision used, 53 if the whole check ran in double **/
+  int precision;
+};
+
+/**
+ * @brief Checks that b is (delta, eta)-LLL-reduced, with a certified answer.
+ *
+ * Unlike is_lll_reduced, which computes the GSO in the given floating-point type and trusts it,
+ * the conditions are checked against rigorous error bounds. The Gram matrix of b is computed
+ * exactly, then its Cholesky factorization (i.e. the GSO, or the R factor of the QR
+ * factorization up to a scaling of its rows) is computed in double, together with a bound on the
+ * error of each coefficient. A row is accepted or rejected only when the error bounds leave no
+ * doubt. The rows which are left undecided are checked again in FP_NR<mpfr_t>, doubling the
+ * precision each time, up to max_prec. The error bounds grow with the index of the row, by about
+ * half a bit per row, so in dimension above 50 or so the last rows are usually decided in mpfr.
+ *
+ * The rows of the Gram matrix and of the factorization are computed in parallel by the threads of
+ * the threadpool (see set_threads). Row i waits for the rows j < i it depends on.
+ *
+ * @param b         basis to check
+ * @param delta     delta of the Lovász condition
+ * @param eta       eta of the size-reduction condition
+ * @param theta     if positive, checks the weak size-reduction of HLLL instead, that is
+ *                  |R(i, j)| <= eta * R(j, j) + theta * R(i, i) (see is_hlll_reduced)
+ * @param max_prec  highest precision tried, 0 means max(106, l2_min_prec(d, delta, eta))
+ */
+LLLVerifyResult verify_lll_reduced(ZZ_mat<mpz_t> &b, double delta = LLL_DEF_DELTA,
+                                   double eta = LLL_DEF_ETA, double theta = 0.0, int max_prec = 0);
+
+/**
+ * @brief verify_lll_reduced with the weak size-reduction of HLLL.
+ */
+inline LLLVerifyResult verify_hlll_reduced(ZZ_mat<mpz_t> &b, double delta = LLL_DEF_DELTA,
+                                           double eta = LLL_DEF_ETA, double theta = HLLL_DEF_THETA,
+                                           int max_prec = 0)
+{
+  return verify_lll_reduced(b, delta, eta, theta, max_prec);
+}
+
+FPLLL_END_NAMESPACE
+
+#endif
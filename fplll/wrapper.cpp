@@ -16,8 +16,11 @@
    along with fplll. If not, see <http://www.gnu.org/licenses/>. */
 
 #include "wrapper.h"
+#include <chrono>
+#include "decompose.h"
 #include "hlll.h"
 #include "lll.h"
+#include "trace.h"
 #include "util.h"
 
 FPLLL_BEGIN_NAMESPACE
@@ -70,7 +73,16 @@ Wrapper::Wrapper(ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u, ZZ_mat<mpz_t> &u_inv, doubl
   good_prec = hlll_min_prec(d, n, delta, eta, theta, c);
 }
 
-bool Wrapper::little(int kappa, int precision)
+/* log2 of the ratio of two consecutive Gram-Schmidt norms after LLL, from the root Hermite factor
+   1.0219 observed for delta close to 1 */
+const double lll_profile_slope = 0.0625;
+
+/* the fast and heuristic methods succeed beyond the dimensions of dim_double_max, by this factor
+   on the corpus used to calibrate lll_predict_prec() */
+const double dim_double_fast = 1.2;
+
+/* dimension below which LLL with this precision is expected to succeed */
+static double dim_max(double delta, double eta, int precision)
 {
   /*one may add here dimension arguments with respect to eta and delta */
   int dm = (int)(delta * 100. - 25.);
@@ -89,8 +101,68 @@ bool Wrapper::little(int kappa, int precision)
 
   p *= eta_dep[em]; /* eta dependance */
   p *= dim_double_max[dm];
-  // cerr << kappa << " compared to " << p << endl;
-  return kappa < p;
+  return p;
+}
+
+bool Wrapper::little(int kappa, int precision) { return kappa < dim_max(delta, eta, precision); }
+
+/**
+ * The precision needed by LLL grows with the number of indices over which the Gram-Schmidt norms
+ * of the output decrease, which can be much less than d. LLL does not widen the range of the
+ * Gram-Schmidt norms, so when they can be computed in double precision, their range bounds this
+ * number. Otherwise (cancellations in the Gram-Schmidt orthogonalization of an ill-conditioned
+ * basis, e.g. a knapsack), the output is assumed to decrease until it has absorbed a determinant
+ * of the bit size of b.
+ */
+template <class ZT, class F> static int predict_prec(ZZ_mat<ZT> &b, double delta, double eta)
+{
+  int d = b.get_rows();
+  if (d == 0 || b.get_cols() == 0)
+    return PREC_DOUBLE;
+
+  ZZ_mat<ZT> u, u_inv;
+  MatGSO<Z_NR<ZT>, FP_NR<F>> m(b, u, u_inv, GSO_DEFAULT);
+  m.update_gso();
+  FP_NR<F> r, g, lost;
+  long max_expo = LONG_MIN, min_expo = LONG_MAX;
+  bool reliable = true;
+  for (int i = 0; i < d && reliable; i++)
+  {
+    m.get_r(r, i, i);
+    m.get_gram(g, i, i);
+    lost.div(g, r);
+    // r_ii is meaningless when most of its bits cancelled out
+    reliable = r.sgn() > 0 && lost.exponent() < PREC_DOUBLE - 10;
+    max_expo = max(max_expo, r.exponent());
+    min_expo = min(min_expo, r.exponent());
+  }
+
+  double active;
+  if (reliable)
+    active = (max_expo - min_expo) / 2.0 / lll_profile_slope;
+  else
+    active = std::sqrt(2.0 * max(b.get_max_exp(), 1L) / lll_profile_slope);
+  double d_eff = min(static_cast<double>(d), active);
+  int prec =
+      (int)ceil(PREC_DOUBLE * d_eff / (dim_double_fast * dim_max(delta, eta, PREC_DOUBLE)));
+  return min(max(prec, PREC_DOUBLE), l2_min_prec(d, delta, eta, LLL_DEF_EPSILON));
+}
+
+template <class ZT> static int predict_prec(ZZ_mat<ZT> &b, double delta, double eta)
+{
+#ifdef FPLLL_WITH_DPE
+  return predict_prec<ZT, dpe_t>(b, delta, eta);
+#else
+  int old_prec = FP_NR<mpfr_t>::set_prec(PREC_DOUBLE);
+  int prec     = predict_prec<ZT, mpfr_t>(b, delta, eta);
+  FP_NR<mpfr_t>::set_prec(old_prec);
+  return prec;
+#endif
+}
+
+int lll_predict_prec(ZZ_mat<mpz_t> &b, double delta, double eta)
+{
+  return predict_prec<mpz_t>(b, delta, eta);
 }
 
 /**
@@ -103,6 +175,18 @@ int Wrapper::call_lll(ZZ_mat<Z> &bz, ZZ_mat<Z> &uz, ZZ_mat<Z> &u_invZ, LLLMethod
   typedef Z_NR<Z> ZT;
   typedef FP_NR<F> FT;
 
+  // A cancelled reduction must not escalate to the next method
+  ReductionControl *control = get_reduction_control();
+  if (control && control->is_cancelled())
+  {
+    status = RED_CANCELLED;
+    return -1;
+  }
+
+  // The previous reduction failed, so this one is run with a more precise method
+  if (stats.lll_calls > 0 && status != RED_SUCCESS)
+    stats.precision_escalations++;
+
   if (flags & LLL_VERBOSE)
   {
     cerr << "====== Wrapper: calling " << LLL_METHOD_STR[method] << "<" << num_type_str<Z>() << ","
@@ -121,6 +205,8 @@ int Wrapper::call_lll(ZZ_mat<Z> &bz, ZZ_mat<Z> &uz, ZZ_mat<Z> &u_invZ, LLLMethod
     gso_flags |= GSO_ROW_EXPO;
   if (method != LM_PROVED && precision == 0)
     gso_flags |= GSO_OP_FORCE_LONG;
+  if (flags & LLL_GSO_WINDOW)
+    gso_flags |= GSO_WINDOW;
 
   int old_prec = FP_NR<mpfr_t>::get_prec();
   if (precision > 0)
@@ -130,7 +216,12 @@ int Wrapper::call_lll(ZZ_mat<Z> &bz, ZZ_mat<Z> &uz, ZZ_mat<Z> &u_invZ, LLLMethod
   MatGSO<ZT, FT> m_gso(bz, uz, u_invZ, gso_flags);
   LLLReduction<ZT, FT> lll_obj(m_gso, delta, eta, flags);
   lll_obj.last_early_red = last_early_red;
+  auto start             = std::chrono::steady_clock::now();
   lll_obj.lll();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  stats += lll_obj.get_stats();
+  stats.add_time(method, elapsed.count());
   status         = lll_obj.status;
   last_early_red = max(last_early_red, lll_obj.last_early_red);
   if (precision > 0)
@@ -272,6 +363,74 @@ int Wrapper::last_lll()
   return proved_lll<mpz_t, mpfr_t>(b, u, u_inv, good_prec, delta, eta);
 }
 
+/* number k of q-vectors if b is a q-ary basis [I | H; 0 | qI] as built by gen_qary, that is d - k
+   rows (e_i | h_i) followed by k rows q e_(d - k + i) with q > 1, and 0 otherwise */
+static int qary_rows(ZZ_mat<mpz_t> &b)
+{
+  int d = b.get_rows();
+  if (d != b.get_cols() || d == 0 || b(d - 1, d - 1) <= 1)
+    return 0;
+  const Z_NR<mpz_t> &q = b(d - 1, d - 1);
+
+  int k = 0;
+  for (bool q_vector = true; k < d && q_vector; k += q_vector)
+  {
+    int i = d - 1 - k;
+    for (int j = 0; j < d && q_vector; j++)
+      q_vector = (j == i) ? b(i, j) == q : b(i, j).is_zero();
+  }
+  if (k == d)
+    return 0;
+  for (int i = 0; i < d - k; i++)
+  {
+    for (int j = 0; j < d - k; j++)
+    {
+      if (b(i, j) != (i == j ? 1 : 0))
+        return 0;
+    }
+  }
+  return k;
+}
+
+/**
+ * q-ary front end (LLL_QARY) for a basis [I | H; 0 | qI] with k q-vectors. The q-vectors are moved
+ * first, where their Gram-Schmidt vectors are known (orthogonal, of norm q) and already
+ * LLL-reduced, and LLL starts right after them: the other rows are size-reduced against them,
+ * i.e. reduced modulo q, and the q-vectors are only moved when the Lovász condition requires it.
+ * The remaining passes of lll() then find a basis which is already reduced.
+ */
+template <class Z> void Wrapper::qary_lll(ZZ_mat<Z> &bz, ZZ_mat<Z> &uz, ZZ_mat<Z> &u_invZ, int k)
+{
+  typedef Z_NR<Z> ZT;
+  typedef FP_NR<double> FT;
+
+  if (flags & LLL_VERBOSE)
+  {
+    cerr << "====== Wrapper: q-ary front end <" << num_type_str<Z>() << ",double> with " << k
+         << " q-vectors ======" << endl;
+  }
+
+  // without row exponents, as the heuristic method, when the entries fit in a long
+  LLLMethod method = use_long ? LM_HEURISTIC : LM_FAST;
+  int gso_flags    = GSO_OP_FORCE_LONG | (use_long ? 0 : GSO_ROW_EXPO);
+  if (flags & LLL_GSO_WINDOW)
+    gso_flags |= GSO_WINDOW;
+  MatGSO<ZT, FT> m_gso(bz, uz, u_invZ, gso_flags);
+  m_gso.discover_all_rows();
+  for (int i = 0; i < k; i++)
+  {
+    m_gso.move_row(d - k + i, i);
+    m_gso.update_gso_row(i);
+  }
+
+  LLLReduction<ZT, FT> lll_obj(m_gso, delta, eta, flags);
+  auto start = std::chrono::steady_clock::now();
+  lll_obj.lll(0, k - 1, d);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  stats += lll_obj.get_stats();
+  stats.add_time(method, elapsed.count());
+}
+
 /**
  * Wrapper.lll() calls
  *  - heuristic_lll()
@@ -280,6 +439,7 @@ int Wrapper::last_lll()
  */
 bool Wrapper::lll()
 {
+  FPLLL_TRACE_ZONE("Wrapper::lll");
   if (b.get_rows() == 0 || b.get_cols() == 0)
     return RED_SUCCESS;
 
@@ -294,6 +454,22 @@ bool Wrapper::lll()
 
   int kappa;
 
+  /* q-ary front end */
+  int qary_k = (flags & LLL_QARY) ? qary_rows(b) : 0;
+  if (qary_k > 0)
+  {
+#ifdef FPLLL_WITH_ZLONG
+    if (heuristic_with_long)
+    {
+      set_use_long(true);
+      qary_lll<long>(b_long, u_long, u_inv_long, qary_k);
+      set_use_long(false);
+    }
+    else
+#endif
+      qary_lll<mpz_t>(b, u, u_inv, qary_k);
+  }
+
   /* small matrix */
   if (heuristic_with_long)
   {
@@ -306,18 +482,26 @@ bool Wrapper::lll()
   /* large matrix */
   else
   {
+    /* with LLL_PREDICT_PREC, the fast methods predicted to fail are skipped */
+    int pred_prec    = (flags & LLL_PREDICT_PREC) ? lll_predict_prec(b, delta, eta) : 0;
+    bool lll_failure = true, fast_tried = false;
+    int last_prec;
 
     /* try fast_lll<mpz_t, double> */
-    kappa            = fast_lll<double>(delta, eta);
-    bool lll_failure = (kappa != 0);
-    int last_prec;
+    if (pred_prec <= numeric_limits<double>::digits)
+    {
+      kappa       = fast_lll<double>(delta, eta);
+      lll_failure = (kappa != 0);
+      fast_tried  = true;
+    }
 
     /* try fast_lll<mpz_t, long double> */
 #ifdef FPLLL_WITH_LONG_DOUBLE
-    if (lll_failure)
+    if (lll_failure && pred_prec <= numeric_limits<long double>::digits)
     {
       kappa       = fast_lll<long double>(delta, eta);
       lll_failure = kappa != 0;
+      fast_tried  = true;
     }
     last_prec = numeric_limits<long double>::digits;
 #else
@@ -326,10 +510,11 @@ bool Wrapper::lll()
 
     /* try fast_lll<mpz_t, dd_real> */
 #ifdef FPLLL_WITH_QD
-    if (lll_failure)
+    if (lll_failure && pred_prec <= PREC_DD)
     {
       kappa       = fast_lll<dd_real>(delta, eta);
       lll_failure = kappa != 0;
+      fast_tried  = true;
     }
     last_prec = PREC_DD;
 #else
@@ -344,7 +529,9 @@ bool Wrapper::lll()
     if (lll_failure)
     {
       int prec_d = numeric_limits<double>::digits;
-      if (little(kappa, last_prec))
+      if (!fast_tried)
+        kappa = heuristic_loop(pred_prec);
+      else if (little(kappa, last_prec))
         kappa = proved_loop(prec_d);
       else
         kappa = heuristic_loop(increase_prec(prec_d));
@@ -537,7 +724,7 @@ bool Wrapper::hlll()
  */
 template <class ZT, class FT>
 int lll_reduction_zf(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv, double delta, double eta,
-                     LLLMethod method, int flags)
+                     LLLMethod method, int flags, LLLStats *stats)
 {
   int gso_flags = 0;
   if (b.get_rows() == 0 || b.get_cols() == 0)
@@ -546,15 +733,24 @@ int lll_reduction_zf(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv, double del
     gso_flags |= GSO_INT_GRAM;
   if (method == LM_FAST)
     gso_flags |= GSO_ROW_EXPO | GSO_OP_FORCE_LONG;
+  if (flags & LLL_GSO_WINDOW)
+    gso_flags |= GSO_WINDOW;
   MatGSO<Z_NR<ZT>, FP_NR<FT>> m_gso(b, u, u_inv, gso_flags);
   LLLReduction<Z_NR<ZT>, FP_NR<FT>> lll_obj(m_gso, delta, eta, flags);
+  auto start = std::chrono::steady_clock::now();
   lll_obj.lll();
+  if (stats)
+  {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    *stats += lll_obj.get_stats();
+    stats->add_time(method, elapsed.count());
+  }
   return lll_obj.status;
 }
 
 template <class ZT>
 int lll_reduction_wrapper(ZZ_mat<ZT> &, ZZ_mat<ZT> &, ZZ_mat<ZT> &, double, double, FloatType, int,
-                          int)
+                          int, LLLStats *)
 {
   FPLLL_ABORT("The wrapper method works only with integer type mpz");
   return RED_LLL_FAILURE;
@@ -562,7 +758,8 @@ int lll_reduction_wrapper(ZZ_mat<ZT> &, ZZ_mat<ZT> &, ZZ_mat<ZT> &, double, doub
 
 template <>
 int lll_reduction_wrapper(ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u, ZZ_mat<mpz_t> &u_inv, double delta,
-                          double eta, FloatType float_type, int precision, int flags)
+                          double eta, FloatType float_type, int precision, int flags,
+                          LLLStats *stats)
 {
   FPLLL_CHECK(float_type == FT_DEFAULT,
               "The floating point type cannot be specified with the wrapper method");
@@ -570,7 +767,9 @@ int lll_reduction_wrapper(ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u, ZZ_mat<mpz_t> &u_i
   Wrapper wrapper(b, u, u_inv, delta, eta, flags);
   wrapper.lll();
   zeros_first(b, u, u_inv);
-  return wrapper.status;
+  if (stats)
+    *stats += wrapper.stats;
+  return target_status(b, wrapper.status);
 }
 
 /**
@@ -579,12 +778,36 @@ int lll_reduction_wrapper(ZZ_mat<mpz_t> &b, ZZ_mat<mpz_t> &u, ZZ_mat<mpz_t> &u_i
 template <class ZT>
 int lll_reduction_z(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv, double delta, double eta,
                     LLLMethod method, IntType int_type, FloatType float_type, int precision,
-                    int flags)
+                    int flags, LLLStats *stats)
 {
 
+  /* orthogonal components reduced independently, then the whole basis (with swaps only) */
+  if (flags & LLL_DECOMPOSE)
+  {
+    flags &= ~LLL_DECOMPOSE;
+    std::mutex stats_mutex;
+    int status = reduce_components<ZT>(
+        b, u, u_inv, [&](ZZ_mat<ZT> &bc, ZZ_mat<ZT> &uc, ZZ_mat<ZT> &uc_inv) {
+          LLLStats component_stats;
+          int component_status = lll_reduction_z(bc, uc, uc_inv, delta, eta, method, int_type,
+                                                 float_type, precision, flags, &component_stats);
+          if (stats)
+          {
+            std::lock_guard<std::mutex> lock(stats_mutex);
+            *stats += component_stats;
+          }
+          return component_status;
+        });
+    if (status != RED_SUCCESS)
+    {
+      zeros_first(b, u, u_inv);
+      return target_status(b, status);
+    }
+  }
+
   /* switch to wrapper */
   if (method == LM_WRAPPER)
-    return lll_reduction_wrapper(b, u, u_inv, delta, eta, float_type, precision, flags);
+    return lll_reduction_wrapper(b, u, u_inv, delta, eta, float_type, precision, flags, stats);
 
   FPLLL_CHECK(!(method == LM_PROVED && (flags & LLL_EARLY_RED)),
               "LLL method 'proved' with early reduction is not implemented");
@@ -598,6 +821,10 @@ int lll_reduction_z(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv, double delt
   {
     sel_prec = (precision != 0) ? precision : good_prec;
   }
+  else if (precision == 0 && float_type == FT_DEFAULT && (flags & LLL_PREDICT_PREC))
+  {
+    sel_prec = predict_prec(b, delta, eta);
+  }
   else
   {
     sel_prec = (precision != 0) ? precision : PREC_DOUBLE;
@@ -619,7 +846,18 @@ int lll_reduction_z(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv, double delt
   if (sel_ft == FT_DEFAULT)
   {
     if (method == LM_FAST)
+    {
+      // the least precise hardware-like type with sel_prec bits, or the most precise one
       sel_ft = FT_DOUBLE;
+#ifdef FPLLL_WITH_LONG_DOUBLE
+      if (sel_prec > PREC_DOUBLE)
+        sel_ft = FT_LONG_DOUBLE;
+#endif
+#ifdef FPLLL_WITH_QD
+      if (sel_prec > (sel_ft == FT_LONG_DOUBLE ? numeric_limits<long double>::digits : PREC_DOUBLE))
+        sel_ft = (sel_prec <= static_cast<int>(FP_NR<dd_real>::get_prec())) ? FT_DD : FT_QD;
+#endif
+    }
 #ifdef FPLLL_WITH_DPE
     else if (sel_prec <= static_cast<int>(FP_NR<dpe_t>::get_prec()))
       sel_ft = FT_DPE;
@@ -681,18 +919,18 @@ int lll_reduction_z(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv, double delt
   int status;
   if (sel_ft == FT_DOUBLE)
   {
-    status = lll_reduction_zf<ZT, double>(b, u, u_inv, delta, eta, method, flags);
+    status = lll_reduction_zf<ZT, double>(b, u, u_inv, delta, eta, method, flags, stats);
   }
 #ifdef FPLLL_WITH_LONG_DOUBLE
   else if (sel_ft == FT_LONG_DOUBLE)
   {
-    status = lll_reduction_zf<ZT, long double>(b, u, u_inv, delta, eta, method, flags);
+    status = lll_reduction_zf<ZT, long double>(b, u, u_inv, delta, eta, method, flags, stats);
   }
 #endif
 #ifdef FPLLL_WITH_DPE
   else if (sel_ft == FT_DPE)
   {
-    status = lll_reduction_zf<ZT, dpe_t>(b, u, u_inv, delta, eta, method, flags);
+    status = lll_reduction_zf<ZT, dpe_t>(b, u, u_inv, delta, eta, method, flags, stats);
   }
 #endif
 #ifdef FPLLL_WITH_QD
@@ -700,21 +938,21 @@ int lll_reduction_z(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv, double delt
   {
     unsigned int old_cw;
     fpu_fix_start(&old_cw);
-    status = lll_reduction_zf<ZT, dd_real>(b, u, u_inv, delta, eta, method, flags);
+    status = lll_reduction_zf<ZT, dd_real>(b, u, u_inv, delta, eta, method, flags, stats);
     fpu_fix_end(&old_cw);
   }
   else if (sel_ft == FT_QD)
   {
     unsigned int old_cw;
     fpu_fix_start(&old_cw);
-    status = lll_reduction_zf<ZT, qd_real>(b, u, u_inv, delta, eta, method, flags);
+    status = lll_reduction_zf<ZT, qd_real>(b, u, u_inv, delta, eta, method, flags, stats);
     fpu_fix_end(&old_cw);
   }
 #endif
   else if (sel_ft == FT_MPFR)
   {
     int old_prec = FP_NR<mpfr_t>::set_prec(sel_prec);
-    status       = lll_reduction_zf<ZT, mpfr_t>(b, u, u_inv, delta, eta, method, flags);
+    status       = lll_reduction_zf<ZT, mpfr_t>(b, u, u_inv, delta, eta, method, flags, stats);
     FP_NR<mpfr_t>::set_prec(old_prec);
   }
   else
@@ -730,7 +968,7 @@ int lll_reduction_z(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv, double delt
     }
   }
   zeros_first(b, u, u_inv);
-  return status;
+  return target_status(b, status);
 }
 
 // Verify if b is hlll reduced according to delta and eta
@@ -1005,33 +1243,34 @@ int hlll_reduction_z(ZZ_mat<ZT> &b, ZZ_mat<ZT> &u, ZZ_mat<ZT> &u_inv, double del
  */
 #define FPLLL_DEFINE_LLL(T, id_t)                                                                  \
   int lll_reduction(ZZ_mat<T> &b, double delta, double eta, LLLMethod method,                      \
-                    FloatType float_type, int precision, int flags)                                \
+                    FloatType float_type, int precision, int flags, LLLStats *stats)               \
   {                                                                                                \
     ZZ_mat<T> empty_mat; /* Empty u -> transform disabled */                                       \
     return lll_reduction_z<T>(b, empty_mat, empty_mat, delta, eta, method, id_t, float_type,       \
-                              precision, flags);                                                   \
+                              precision, flags, stats);                                            \
   }                                                                                                \
                                                                                                    \
   int lll_reduction(ZZ_mat<T> &b, ZZ_mat<T> &u, double delta, double eta, LLLMethod method,        \
-                    FloatType float_type, int precision, int flags)                                \
+                    FloatType float_type, int precision, int flags, LLLStats *stats)               \
   {                                                                                                \
     ZZ_mat<T> empty_mat;                                                                           \
     if (!u.empty())                                                                                \
       u.gen_identity(b.get_rows());                                                                \
     return lll_reduction_z<T>(b, u, empty_mat, delta, eta, method, id_t, float_type, precision,    \
-                              flags);                                                              \
+                              flags, stats);                                                       \
   }                                                                                                \
                                                                                                    \
   int lll_reduction(ZZ_mat<T> &b, ZZ_mat<T> &u, ZZ_mat<T> &u_inv, double delta, double eta,        \
-                    LLLMethod method, FloatType float_type, int precision, int flags)              \
+                    LLLMethod method, FloatType float_type, int precision, int flags,              \
+                    LLLStats *stats)                                                               \
   {                                                                                                \
     if (!u.empty())                                                                                \
       u.gen_identity(b.get_rows());                                                                \
     if (!u_inv.empty())                                                                            \
       u_inv.gen_identity(b.get_rows());                                                            \
     u_inv.transpose();                                                                             \
-    int status =                                                                                   \
-        lll_reduction_z<T>(b, u, u_inv, delta, eta, method, id_t, float_type, precision, flags);   \
+    int status = lll_reduction_z<T>(b, u, u_inv, delta, eta, method, id_t, float_type, precision,  \
+                                    flags, stats);                                                 \
     u_inv.transpose();                                                                             \
     return status;                                                                                 \
   }
@@ -18,6 +18,7 @@
 #ifndef FPLLL_WRAPPER_H
 #define FPLLL_WRAPPER_H
 
+#include "counters.h"
 #include "nr/matrix.h"
 
 FPLLL_BEGIN_NAMESPACE
@@ -45,6 +46,9 @@ public:
 
   int status;
 
+  /** Counters aggregated over all the reductions tried by lll(). */
+  LLLStats stats;
+
 private:
   ZZ_mat<mpz_t> &b;
   ZZ_mat<mpz_t> &u;
@@ -78,6 +82,8 @@ private:
   int proved_lll(ZZ_mat<Z> &bz, ZZ_mat<Z> &uz, ZZ_mat<Z> &u_inv_z, int precision, double delta,
                  double eta);
 
+  template <class Z> void qary_lll(ZZ_mat<Z> &bz, ZZ_mat<Z> &uz, ZZ_mat<Z> &u_inv_z, int k);
+
   int heuristic_loop(int precision);
   int proved_loop(int precision);
   int last_lll();
@@ -111,18 +117,28 @@ private:
   bool last_hlll();
 };
 
+/**
+ * LLL reduction of b (see the README). If `stats` is not null, the counters of all the reductions
+ * performed (by all the methods tried with LM_WRAPPER) are added to it. With LM_WRAPPER and the
+ * flag LLL_QARY, a q-ary basis [I | H; 0 | qI] (see gen_qary) is first reduced in double precision
+ * with the q-vectors moved first, so that the other rows are reduced modulo q before any swap.
+ * Other bases are reduced as without the flag. With the flag LLL_DECOMPOSE, the orthogonal
+ * components of b (see reduce_components) are first reduced independently and in parallel.
+ */
 #define FPLLL_DECLARE_LLL(T)                                                                       \
   int lll_reduction(ZZ_mat<T> &b, double delta = LLL_DEF_DELTA, double eta = LLL_DEF_ETA,          \
                     LLLMethod method = LM_WRAPPER, FloatType floatType = FT_DEFAULT,               \
-                    int precision = 0, int flags = LLL_DEFAULT);                                   \
+                    int precision = 0, int flags = LLL_DEFAULT, LLLStats *stats = nullptr);        \
                                                                                                    \
   int lll_reduction(ZZ_mat<T> &b, ZZ_mat<T> &u, double delta = LLL_DEF_DELTA,                      \
                     double eta = LLL_DEF_ETA, LLLMethod method = LM_WRAPPER,                       \
-                    FloatType floatType = FT_DEFAULT, int precision = 0, int flags = LLL_DEFAULT); \
+                    FloatType floatType = FT_DEFAULT, int precision = 0, int flags = LLL_DEFAULT,  \
+                    LLLStats *stats = nullptr);                                                    \
                                                                                                    \
   int lll_reduction(ZZ_mat<T> &b, ZZ_mat<T> &u, ZZ_mat<T> &u_inv, double delta = LLL_DEF_DELTA,    \
                     double eta = LLL_DEF_ETA, LLLMethod method = LM_WRAPPER,                       \
-                    FloatType floatType = FT_DEFAULT, int precision = 0, int flags = LLL_DEFAULT);
+                    FloatType floatType = FT_DEFAULT, int precision = 0, int flags = LLL_DEFAULT,  \
+                    LLLStats *stats = nullptr);
 
 FPLLL_DECLARE_LLL(mpz_t)
 
@@ -134,6 +150,16 @@ FPLLL_DECLARE_LLL(long)
 FPLLL_DECLARE_LLL(double)
 #endif
 
+/**
+ * Precision (in bits) predicted for the heuristic and fast LLL of b, from the dimension, the bit
+ * size and the range of the Gram-Schmidt norms of b computed in double precision. It is at least
+ * 53 and at most l2_min_prec(). With the flag LLL_PREDICT_PREC, lll_reduction uses it to choose
+ * the floating-point type up front: the wrapper skips the fast methods with less precision (and
+ * still increases the precision when a method fails), LM_FAST and LM_HEURISTIC with FT_DEFAULT
+ * use the least precise type with this precision.
+ */
+int lll_predict_prec(ZZ_mat<mpz_t> &b, double delta = LLL_DEF_DELTA, double eta = LLL_DEF_ETA);
+
 // HLLL
 
 /**
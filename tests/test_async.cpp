@@ -0,0 +1,322 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include <atomic>
+#include <cstring>
+#include <fplll.h>
+#include <thread>
+
+using namespace std;
+using namespace fplll;
+
+/**
+   @brief Wait until `pred` holds or `seconds` have passed.
+
+   @return true if `pred` holds.
+*/
+
+template <class Pred> bool wait_until(Pred pred, int seconds = 60)
+{
+  auto end = chrono::steady_clock::now() + chrono::seconds(seconds);
+  while (!pred())
+  {
+    if (chrono::steady_clock::now() > end)
+      return false;
+    this_thread::sleep_for(chrono::milliseconds(5));
+  }
+  return true;
+}
+
+/**
+   @brief Test that an asynchronous LLL reduction gives the same result as the synchronous one.
+
+   @param d                dimension
+   @param b                bit size
+
+   @return zero on success.
+*/
+
+int test_async_lll(int d, int b)
+{
+  ZZ_mat<mpz_t> A, B;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  B = A;
+
+  lll_reduction(A);
+  ReductionJob job = lll_reduction_async(B);
+  if (!job.valid() || job.get() != RED_SUCCESS)
+  {
+    cerr << "Asynchronous LLL reduction failed" << endl;
+    return 1;
+  }
+  if (!job.is_done())
+  {
+    cerr << "Asynchronous LLL reduction not done after get()" << endl;
+    return 1;
+  }
+
+  for (int i = 0; i < d; i++)
+  {
+    for (int j = 0; j < d + 1; j++)
+    {
+      if (A[i][j] != B[i][j])
+      {
+        cerr << "Asynchronous LLL reduction differs from the synchronous one" << endl;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+   @brief Test that reductions started with an already cancelled control stop immediately.
+
+   @param d                dimension
+   @param b                bit size
+
+   @return zero on success.
+*/
+
+int test_cancelled_control(int d, int b)
+{
+  int status = 0;
+  ZZ_mat<mpz_t> A, B;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  B = A;
+
+  ReductionControl control;
+  control.cancel();
+  {
+    ReductionControlScope scope(&control);
+    status |= lll_reduction(A) != RED_CANCELLED;
+    status |= lll_reduction(A, LLL_DEF_DELTA, LLL_DEF_ETA, LM_FAST, FT_DOUBLE) != RED_CANCELLED;
+    status |= bkz_reduction(A, 10, BKZ_DEFAULT, FT_DOUBLE) != RED_CANCELLED;
+  }
+  // detached again
+  status |= lll_reduction(A) != RED_SUCCESS;
+  lll_reduction(B);
+  for (int i = 0; i < d; i++)
+    for (int j = 0; j < d + 1; j++)
+      status |= A[i][j] != B[i][j];
+
+  if (status)
+    cerr << "Reduction with a cancelled control did not behave as expected" << endl;
+  return status;
+}
+
+/**
+   @brief Cancel a long BKZ reduction after it reported some progress.
+
+   @param d                dimension
+   @param b                bit size
+   @param block_size       block size
+
+   @return zero on success.
+*/
+
+int test_cancel_bkz(int d, int b, int block_size)
+{
+  ZZ_mat<mpz_t> A;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+
+  atomic<int> callbacks(0);
+  vector<Strategy> strategies;
+  BKZParam param(block_size, strategies);
+  ReductionJob job = bkz_reduction_async(A, param, FT_DEFAULT, 0,
+                                         [&callbacks](const ReductionProgress &) { ++callbacks; });
+
+  auto in_bkz = [&]() {
+    return (callbacks > 0 && job.get_progress().stage == STAGE_BKZ) || job.is_done();
+  };
+  if (!wait_until(in_bkz))
+  {
+    cerr << "BKZ did not report progress" << endl;
+    job.cancel();
+    job.get();
+    return 1;
+  }
+  job.cancel();
+  if (!job.wait_for(60 * 1000))
+  {
+    cerr << "BKZ did not stop after cancellation" << endl;
+    job.get();
+    return 1;
+  }
+
+  ReductionProgress progress = job.get_progress();
+  int status                 = job.get();
+  if (status != RED_CANCELLED || callbacks == 0 || progress.stage != STAGE_BKZ)
+  {
+    cerr << "BKZ cancellation failed: " << get_red_status_str(status) << ", " << callbacks
+         << " callbacks, stage " << REDUCTION_STAGE_STR[progress.stage] << endl;
+    return 1;
+  }
+  return 0;
+}
+
+/**
+   @brief Cancel a long SVP enumeration (with fplll's own enumeration) after it visited some nodes.
+
+   @param d                dimension
+   @param b                bit size
+
+   @return zero on success.
+*/
+
+int test_cancel_svp(int d, int b)
+{
+  ZZ_mat<mpz_t> A;
+  A.resize(d, d);
+  A.gen_uniform(b);
+  lll_reduction(A);
+
+  auto extenum = get_external_enumerator();
+  set_external_enumerator(nullptr);
+
+  vector<Z_NR<mpz_t>> sol_coord;
+  ReductionJob job = shortest_vector_async(A, sol_coord, SVPM_FAST);
+  bool started     = wait_until([&]() { return job.get_progress().nodes > 0 || job.is_done(); });
+  job.cancel();
+  bool stopped = job.wait_for(60 * 1000);
+  int status   = job.get();
+  set_external_enumerator(extenum);
+
+  if (!started || !stopped || status != RED_CANCELLED || job.get_progress().stage != STAGE_ENUM)
+  {
+    cerr << "SVP cancellation failed: " << get_red_status_str(status) << endl;
+    return 1;
+  }
+  return 0;
+}
+
+/**
+   @brief Squared norm of the shortest nonzero row of A.
+*/
+
+double min_sq_norm(ZZ_mat<mpz_t> &A)
+{
+  double result = 0.0;
+  Z_NR<mpz_t> norm;
+  for (int i = 0; i < A.get_rows(); i++)
+  {
+    A[i].dot_product(norm, A[i]);
+    if (!norm.is_zero() && (result == 0.0 || norm.get_d() < result))
+      result = norm.get_d();
+  }
+  return result;
+}
+
+/**
+   @brief Test that LLL, BKZ and HKZ stop at the target norm and report the row meeting it.
+
+   @param d                dimension
+   @param b                bit size
+   @param block_size       block size
+
+   @return zero on success.
+*/
+
+int test_target_norm(int d, int b, int block_size)
+{
+  int status = 0;
+  ZZ_mat<mpz_t> A, B;
+  A.resize(d, d);
+  A.gen_uniform(b);
+
+  // met by the first row: LLL stops before changing anything
+  {
+    B = A;
+    Z_NR<mpz_t> norm;
+    B[0].dot_product(norm, B[0]);
+    ReductionControl control;
+    control.set_target_norm(1.001 * norm.get_d());
+    ReductionControlScope scope(&control);
+    status |= lll_reduction(B) != RED_TARGET_REACHED;
+    status |= control.get_target_index() != 0;
+    for (int i = 0; i < d; i++)
+      for (int j = 0; j < d; j++)
+        status |= A[i][j] != B[i][j];
+  }
+  if (status)
+  {
+    cerr << "LLL did not stop at the target norm of the first row" << endl;
+    return status;
+  }
+
+  // met by BKZ and HKZ only, the target is the norm reached by a full reduction
+  lll_reduction(A);
+  double lll_norm = min_sq_norm(A);
+  for (int hkz = 0; hkz < 2; hkz++)
+  {
+    B = A;
+    int full_status = hkz ? hkz_reduction(B) : bkz_reduction(B, block_size);
+    double target   = 1.001 * min_sq_norm(B);
+    if (full_status != RED_SUCCESS || target >= lll_norm)
+    {
+      cerr << "No progress of BKZ over LLL in test_target_norm" << endl;
+      return 1;
+    }
+
+    B = A;
+    ReductionControl control;
+    control.set_target_norm(target);
+    ReductionControlScope scope(&control);
+    int target_status = hkz ? hkz_reduction(B) : bkz_reduction(B, block_size);
+    int index         = control.get_target_index();
+    Z_NR<mpz_t> norm;
+    if (target_status != RED_TARGET_REACHED || index < 0 || index >= d)
+    {
+      cerr << (hkz ? "HKZ" : "BKZ") << " did not stop at the target norm: "
+           << get_red_status_str(target_status) << endl;
+      return 1;
+    }
+    B[index].dot_product(norm, B[index]);
+    if (norm.get_d() > target)
+    {
+      cerr << "Row " << index << " reported by " << (hkz ? "HKZ" : "BKZ")
+           << " does not meet the target norm" << endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+
+  int status = 0;
+
+  status |= test_async_lll(30, 100);
+  status |= test_cancelled_control(30, 100);
+  status |= test_cancel_bkz(100, 1000, 40);
+  status |= test_cancel_svp(80, 10);
+  status |= test_target_norm(40, 30, 20);
+
+  if (status == 0)
+  {
+    cerr << "All tests passed." << endl;
+    return 0;
+  }
+  else
+  {
+    return -1;
+  }
+
+  return 0;
+}
@@ -310,6 +310,291 @@ int test_int_rel(int d, int b, const int block_size, FloatType float_type = FT_D
   return status;
 }
 
+/**
+   @brief Check the output of a BKZ reduction of an LLL-reduced basis: it must be LLL-reduced,
+   generate a lattice of the same volume and have a better slope than the input.
+
+   @param A                LLL-reduced input
+   @param C                BKZ-reduced output
+   @param what             name of the reduction for error messages
+
+   @return zero on success.
+*/
+
+int check_bkz_output(ZZ_mat<mpz_t> &A, ZZ_mat<mpz_t> &C, const char *what)
+{
+  int status = 0;
+  int d      = A.get_rows();
+  ZZ_mat<mpz_t> U;
+  MatGSO<Z_NR<mpz_t>, FP_NR<double>> MA(A, U, U, GSO_DEFAULT), MC(C, U, U, GSO_DEFAULT);
+  MA.update_gso();
+  MC.update_gso();
+  double log_det_a = MA.get_log_det(0, d).get_d(), log_det_c = MC.get_log_det(0, d).get_d();
+  if (fabs(log_det_a - log_det_c) > 1e-6 * fabs(log_det_a))
+  {
+    cerr << what << " changed the volume of the lattice" << endl;
+    status = 1;
+  }
+  if (!is_lll_reduced<Z_NR<mpz_t>, FP_NR<double>>(MC, LLL_DEF_DELTA, LLL_DEF_ETA))
+  {
+    cerr << what << " output is not LLL reduced" << endl;
+    status = 1;
+  }
+  if (MC.get_current_slope(0, d) < MA.get_current_slope(0, d))
+  {
+    cerr << what << " did not improve the LLL reduced basis" << endl;
+    status = 1;
+  }
+  return status;
+}
+
+/**
+   @brief Compare BKZ with parallel tours to sequential BKZ.
+
+   @param d                dimension
+   @param b                bit size
+   @param block_size       block size
+   @param threads          number of threads
+   @param parallel_blocks  number of blocks enumerated concurrently (0 = automatic)
+
+   @return zero on success.
+*/
+
+int test_bkz_parallel(int d, int b, const int block_size, int threads, int parallel_blocks)
+{
+  ZZ_mat<mpz_t> A;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  lll_reduction(A);
+  ZZ_mat<mpz_t> C = A;
+
+  vector<Strategy> strategies;
+  BKZParam param(block_size, strategies);
+  int old_threads       = get_threads();
+  param.flags           = BKZ_PARALLEL;
+  param.parallel_blocks = parallel_blocks;
+  set_threads(threads);
+  int status = bkz_reduction(&C, NULL, param, FT_DOUBLE);
+  set_threads(old_threads);
+  if (status != RED_SUCCESS)
+  {
+    cerr << "Parallel BKZ reduction failed with error '" << get_red_status_str(status) << "'"
+         << endl;
+    return status;
+  }
+  return check_bkz_output(A, C, "Parallel BKZ");
+}
+
+/**
+   @brief Test BKZ with preprocessing in local coordinates, with and without preprocessing tours.
+
+   @param d                dimension
+   @param b                bit size
+   @param block_size       block size
+
+   @return zero on success.
+*/
+
+int test_bkz_local_preproc(int d, int b, const int block_size)
+{
+  ZZ_mat<mpz_t> A;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  lll_reduction(A);
+  ZZ_mat<mpz_t> B = A, C = A;
+
+  int status = test_bkz<mpz_t>(B, block_size, FT_DOUBLE, BKZ_LOCAL_PREPROC);
+  status |= test_bkz_param<mpz_t>(C, block_size, BKZ_LOCAL_PREPROC);
+  if (status)
+    return status;
+  status |= check_bkz_output(A, B, "BKZ with local preprocessing");
+  status |= check_bkz_output(A, C, "BKZ with local preprocessing tours");
+  return status;
+}
+
+/**
+   @brief Test BKZ_ROTATIONS on an NTRU lattice {(u, u * h) mod q} with h = g / f mod (x^n - 1, q),
+   f = 1 + 3x and g ternary: the transformation must map the input to the output, the output must
+   be a BKZ reduced basis of the same lattice, and b_0 must be at most as long as the key (f, g).
+
+   @param n                degree, the dimension is 2n
+   @param q                prime modulus, such that f is invertible
+   @param block_size       block size
+
+   @return zero on success.
+*/
+
+int test_bkz_rotations(int n, long q, const int block_size)
+{
+  // 1 / f = (1 - (-3)^n)^-1 * sum_(k < n) (-3)^k x^k, the inverse of 1 - (-3)^n is its power q - 2
+  vector<long> pow3(n + 1), g(n), h(n, 0);
+  pow3[0] = 1;
+  for (int k = 1; k <= n; k++)
+    pow3[k] = (pow3[k - 1] * (q - 3)) % q;
+  long c = 1, base = (1 - pow3[n] + q) % q;
+  for (long e = q - 2; e > 0; e >>= 1, base = (base * base) % q)
+  {
+    if (e & 1)
+      c = (c * base) % q;
+  }
+  long key_norm = 10;
+  for (int i = 0; i < n; i++)
+  {
+    g[i] = (long)gmp_urandomm_ui(RandGen::get_gmp_state(), 3) - 1;
+    key_norm += g[i] * g[i];
+  }
+  for (int i = 0; i < n; i++)
+    for (int k = 0; k < n; k++)
+      h[(i + k) % n] = (h[(i + k) % n] + (g[i] + q) * (pow3[k] * c % q)) % q;
+
+  ZZ_mat<mpz_t> A, U;
+  A.resize(2 * n, 2 * n);
+  for (int i = 0; i < n; i++)
+  {
+    A[i][i] = 1;
+    for (int j = 0; j < n; j++)
+      A[i][n + j] = h[(j - i + n) % n];
+    A[n + i][n + i] = q;
+  }
+  lll_reduction(A);
+  ZZ_mat<mpz_t> C = A;
+  U.gen_identity(2 * n);
+
+  vector<Strategy> strategies;
+  BKZParam param(block_size, strategies);
+  param.flags = BKZ_ROTATIONS;
+  int status  = bkz_reduction(&C, &U, param, FT_DOUBLE);
+  if (status != RED_SUCCESS)
+  {
+    cerr << "BKZ reduction with rotations failed with error '" << get_red_status_str(status) << "'"
+         << endl;
+    return status;
+  }
+  Z_NR<mpz_t> x;
+  for (int i = 0; i < 2 * n; i++)
+  {
+    for (int j = 0; j < 2 * n; j++)
+    {
+      x = 0;
+      for (int k = 0; k < 2 * n; k++)
+        x.addmul(U[i][k], A[k][j]);
+      if (x != C[i][j])
+      {
+        cerr << "BKZ reduction with rotations returned a wrong transformation" << endl;
+        return 1;
+      }
+    }
+  }
+  C[0].dot_product(x, C[0]);
+  if (x > key_norm)
+  {
+    cerr << "BKZ reduction with rotations did not find the key" << endl;
+    return 1;
+  }
+  return check_bkz_output(A, C, "BKZ with rotations");
+}
+
+/**
+   @brief Test BKZ_DECOMPOSE with two threads on a block-diagonal basis made of `blocks` integer
+   relation matrices of dimension d and bit size b, with interleaved rows: the transformation must
+   map the input to the output, which must be a BKZ reduced basis of the same lattice.
+
+   @param blocks           number of blocks
+   @param d                dimension of each block
+   @param b                bit size
+   @param block_size       block size
+
+   @return zero on success.
+*/
+
+int test_bkz_decompose(int blocks, int d, int b, const int block_size)
+{
+  ZZ_mat<mpz_t> A, U, block;
+  A.resize(blocks * d, blocks * (d + 1));
+  block.resize(d, d + 1);
+  for (int k = 0; k < blocks; k++)
+  {
+    block.gen_intrel(b);
+    for (int i = 0; i < d; i++)
+      for (int j = 0; j < d + 1; j++)
+        A[i * blocks + k][k * (d + 1) + j] = block[i][j];
+  }
+  lll_reduction(A);
+  ZZ_mat<mpz_t> C = A;
+  U.gen_identity(blocks * d);
+
+  vector<Strategy> strategies;
+  BKZParam param(block_size, strategies);
+  param.flags     = BKZ_DECOMPOSE;
+  int old_threads = get_threads();
+  set_threads(2);
+  int status = bkz_reduction(&C, &U, param, FT_DOUBLE);
+  set_threads(old_threads);
+  if (status != RED_SUCCESS)
+  {
+    cerr << "BKZ reduction of the components failed with error '" << get_red_status_str(status)
+         << "'" << endl;
+    return status;
+  }
+  Z_NR<mpz_t> x;
+  for (int i = 0; i < A.get_rows(); i++)
+  {
+    for (int j = 0; j < A.get_cols(); j++)
+    {
+      x = 0;
+      for (int k = 0; k < A.get_rows(); k++)
+        x.addmul(U[i][k], A[k][j]);
+      if (x != C[i][j])
+      {
+        cerr << "BKZ reduction of the components returned a wrong transformation" << endl;
+        return 1;
+      }
+    }
+  }
+  return check_bkz_output(A, C, "BKZ of the components");
+}
+
+/**
+   @brief Test BKZ on MatHouseholder (BKZ_METHOD_HOUSEHOLDER).
+
+   @param d                dimension
+   @param b                bit size
+   @param block_size       block size
+   @param float_type       floating-point type of the Householder R factor
+   @param precision        precision if float_type is FT_MPFR
+
+   @return zero on success.
+*/
+
+int test_bkz_householder(int d, int b, const int block_size, FloatType float_type,
+                         int precision = 0)
+{
+  ZZ_mat<mpz_t> A;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  lll_reduction(A);
+  ZZ_mat<mpz_t> C = A;
+
+  vector<Strategy> strategies;
+  for (long bs = 0; bs <= block_size; bs++)
+  {
+    Strategy strategy = Strategy::EmptyStrategy(bs);
+    if (bs == 20)
+      strategy.preprocessing_block_sizes.emplace_back(10);
+    strategies.emplace_back(std::move(strategy));
+  }
+  BKZParam param(block_size, strategies);
+  param.method = BKZ_METHOD_HOUSEHOLDER;
+  int status   = bkz_reduction(&C, NULL, param, float_type, precision);
+  if (status != RED_SUCCESS)
+  {
+    cerr << "Householder BKZ reduction failed with error '" << get_red_status_str(status) << "'"
+         << endl;
+    return status;
+  }
+  return check_bkz_output(A, C, "Householder BKZ");
+}
+
 int test_linear_dep()
 {
   ZZ_mat<mpz_t> A;
@@ -374,6 +659,22 @@ int main(int /*argc*/, char ** /*argv*/)
   status |=
       test_filename<mpz_t>(TESTDATADIR "/tests/lattices/example_in", 10, FT_DOUBLE, BKZ_SLD_RED);
 
+  // Test BKZ_PARALLEL, with the automatic thread budget and with two blocks at a time
+  status |= test_bkz_parallel(60, 1000, 10, 4, 0);
+  status |= test_bkz_parallel(60, 1000, 10, 4, 2);
+
+  // Test BKZ_LOCAL_PREPROC
+  status |= test_bkz_local_preproc(60, 1000, 20);
+
+  // Test BKZ_ROTATIONS
+  status |= test_bkz_rotations(30, 97, 20);
+
+  // Test BKZ_DECOMPOSE
+  status |= test_bkz_decompose(2, 30, 300, 15);
+
+  status |= test_bkz_householder(60, 1000, 20, FT_DOUBLE);
+  status |= test_bkz_householder(40, 1000, 10, FT_MPFR, 100);
+
   // Test BKZ_DUMP_GSO
   status |= test_int_rel_bkz_dump_gso<mpz_t>(50, 1000, 15, BKZ_DEFAULT | BKZ_DUMP_GSO);
 
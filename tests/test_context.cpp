@@ -0,0 +1,202 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include <cstring>
+#include <fplll.h>
+#include <thread>
+
+using namespace std;
+using namespace fplll;
+
+/**
+   @brief Compare two matrices entry by entry.
+*/
+
+bool same_matrix(const ZZ_mat<mpz_t> &A, const ZZ_mat<mpz_t> &B)
+{
+  if (A.get_rows() != B.get_rows() || A.get_cols() != B.get_cols())
+    return false;
+  for (int i = 0; i < A.get_rows(); i++)
+    for (int j = 0; j < A.get_cols(); j++)
+      if (A[i][j] != B[i][j])
+        return false;
+  return true;
+}
+
+/**
+   @brief Test that a context has its own random generator: two threads with contexts of the same
+   seed draw the same matrix, and drawing in a context does not advance the global generator.
+
+   @param d                dimension
+   @param b                bit size
+
+   @return zero on success.
+*/
+
+int test_context_random(int d, int b)
+{
+  ZZ_mat<mpz_t> A1, A2, B1, B2, C1, C2;
+  for (ZZ_mat<mpz_t> *M : {&A1, &A2, &B1, &B2, &C1, &C2})
+    M->resize(d, d);
+
+  RandGen::init_with_seed(1);
+  A1.gen_uniform(b);
+  A2.gen_uniform(b);
+
+  ReductionContext ctx1(42), ctx2(42);
+  RandGen::init_with_seed(1);
+  B1.gen_uniform(b);
+  thread t1([&]() {
+    ReductionContextScope scope(&ctx1);
+    C1.gen_uniform(b);
+  });
+  thread t2([&]() {
+    ReductionContextScope scope(&ctx2);
+    C2.gen_uniform(b);
+  });
+  t1.join();
+  t2.join();
+  B2.gen_uniform(b);
+
+  if (!same_matrix(A1, B1) || !same_matrix(A2, B2))
+  {
+    cerr << "A context changed the state of the global random generator" << endl;
+    return 1;
+  }
+  if (!same_matrix(C1, C2))
+  {
+    cerr << "Two contexts with the same seed draw different matrices" << endl;
+    return 1;
+  }
+  if (same_matrix(A1, C1))
+  {
+    cerr << "A context uses the global random generator" << endl;
+    return 1;
+  }
+  return 0;
+}
+
+/**
+   @brief Test that the external enumerator, the threadpool and the precision of MPFR of a context
+   are used while it is attached and do not leak to the process.
+
+   @return zero on success.
+*/
+
+int test_context_state()
+{
+  auto extenum          = get_external_enumerator();
+  int threads           = get_threads();
+  unsigned int old_prec = FP_NR<mpfr_t>::get_prec();
+
+  ReductionContext ctx(0, threads + 1);
+  ctx.precision = old_prec + 64;
+  {
+    ReductionContextScope scope(&ctx);
+    set_external_enumerator(nullptr);
+    if (get_external_enumerator() != nullptr || get_threads() != threads + 1 ||
+        FP_NR<mpfr_t>::get_prec() != old_prec + 64)
+    {
+      cerr << "The state of a context is not used while it is attached" << endl;
+      return 1;
+    }
+  }
+  if ((get_external_enumerator() == nullptr) != (extenum == nullptr) ||
+      get_threads() != threads || FP_NR<mpfr_t>::get_prec() != old_prec)
+  {
+    cerr << "The state of a context leaked to the process" << endl;
+    return 1;
+  }
+  if (ctx.external_enumerator != nullptr || ctx.pool.size() != size_t(threads))
+  {
+    cerr << "The state of a context was not kept after it was detached" << endl;
+    return 1;
+  }
+  return 0;
+}
+
+/**
+   @brief Test that two BKZ reductions run concurrently in two threads with their own contexts
+   give the same bases as sequential reductions without a context.
+
+   @param d                dimension
+   @param b                bit size
+   @param block_size       block size
+
+   @return zero on success.
+*/
+
+int test_concurrent_bkz(int d, int b, int block_size)
+{
+  ZZ_mat<mpz_t> A[2], B[2];
+  for (int i = 0; i < 2; i++)
+  {
+    A[i].resize(d, d + 1);
+    A[i].gen_intrel(b + i);
+    B[i] = A[i];
+  }
+
+  vector<Strategy> strategies;
+  BKZParam param(block_size, strategies);
+  param.flags = BKZ_DEFAULT;
+  for (int i = 0; i < 2; i++)
+    bkz_reduction(&A[i], NULL, param);
+
+  ReductionContext ctx[2];
+  int status[2];
+  vector<thread> threads;
+  for (int i = 0; i < 2; i++)
+    threads.emplace_back([&, i]() { status[i] = bkz_reduction(ctx[i], B[i], param); });
+  for (thread &t : threads)
+    t.join();
+
+  for (int i = 0; i < 2; i++)
+  {
+    if (status[i] != RED_SUCCESS)
+    {
+      cerr << "BKZ reduction in a context failed with error '" << get_red_status_str(status[i])
+           << "'" << endl;
+      return 1;
+    }
+    if (!same_matrix(A[i], B[i]))
+    {
+      cerr << "BKZ reduction in a context differs from the one without context" << endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+
+  int status = 0;
+
+  status |= test_context_random(10, 30);
+  status |= test_context_state();
+  status |= test_concurrent_bkz(40, 100, 10);
+
+  if (status == 0)
+  {
+    cerr << "All tests passed." << endl;
+    return 0;
+  }
+  else
+  {
+    return -1;
+  }
+
+  return 0;
+}
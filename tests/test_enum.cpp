@@ -14,6 +14,7 @@
    along with fplll. If not, see <http://www.gnu.org/licenses/>. */
 
 #include <cstring>
+#include <enum/topenum.h>
 #include <fplll/fplll.h>
 
 using namespace fplll;
@@ -87,11 +88,137 @@ template <class FT> int test_callback_enum(size_t d)
   }
 }
 
+/**
+   @brief Run enumeration with pinned threads and check that the placement counters are updated.
+*/
+template <class FT> int test_affinity_enum(size_t d)
+{
+  int status = 0;
+  if (set_thread_affinity("not a cpu list") != -1)
+    status |= 1;
+
+  set_threads(2);
+  reset_affinity_stats();
+  set_thread_affinity(AFFINITY_SCATTER);
+  status |= test_enum<FT>(d);
+
+  AffinityStats stats = get_affinity_stats();
+  if (stats.pinned_threads + stats.pin_failures != uint64_t(get_threads()))
+    status |= 1;
+#if FPLLL_MAX_PARALLEL_ENUM_DIM != 0
+  if (stats.jobs == 0 || stats.migrations > stats.jobs)
+    status |= 1;
+#endif
+
+  set_thread_affinity(AFFINITY_NONE);
+  set_threads(1);
+  return status;
+}
+
+/**
+   @brief Compare the estimated size of an enumeration tree with the number of nodes visited.
+
+   The evaluator keeps many solutions, so the radius is never decreased and the estimator
+   describes exactly the tree which is explored.
+
+   @param d                dimension of the block
+   @return zero on success
+*/
+
+template <class FT> int test_estimate_enum(size_t d)
+{
+  RandGen::init_with_seed(0x1337);
+  ZZ_mat<mpz_t> A = ZZ_mat<mpz_t>(100, 100);
+  A.gen_qary_withq(50, 7681);
+  lll_reduction(A);
+  ZZ_mat<mpz_t> U;
+  MatGSO<Z_NR<mpz_t>, FP_NR<FT>> M(A, U, U, 0);
+  M.update_gso();
+
+  FastEvaluator<FP_NR<FT>> evaluator(1 << 20);
+  EnumerationDyn<Z_NR<mpz_t>, FP_NR<FT>> enum_obj(M, evaluator);
+  FP_NR<FT> max_dist;
+  M.get_r(max_dist, 0, 0);
+
+  EnumerationEstimate estimate = enum_obj.estimate_nodes(0, d, max_dist, 0, {}, false, 20000);
+  enum_obj.enumerate(0, d, max_dist, 0);
+  double nodes = static_cast<double>(enum_obj.get_nodes());
+
+  double level_sum = 0.0;
+  for (double level_nodes : estimate.level_nodes)
+    level_sum += level_nodes;
+
+  int status = 0;
+  status |= estimate.descents != 20000 || estimate.level_nodes.size() != d;
+  status |= fabs(level_sum - estimate.nodes) > 1e-6 * estimate.nodes;
+  status |= fabs(estimate.nodes - nodes) > 0.25 * nodes;
+  if (status)
+  {
+    std::cerr << "Enumeration estimate " << estimate.nodes << " (error " << estimate.error
+              << ") far from " << nodes << " nodes" << std::endl;
+  }
+  return status;
+}
+
+/**
+   @brief Split an enumeration into subtrees with the top-level Enumerator and check that the
+   enumerations of the subtrees find the vector found by the enumeration of the whole tree.
+
+   @param d                dimension
+   @param max_volume       maximal estimated volume of a subtree
+   @return zero on success
+*/
+
+int test_top_enum(int d, double max_volume)
+{
+  RandGen::init_with_seed(0x1337);
+  ZZ_mat<mpz_t> A = ZZ_mat<mpz_t>(d, d);
+  A.gen_qary_withq(d / 2, 7681);
+  lll_reduction(A);
+  ZZ_mat<mpz_t> U;
+  MatGSO<Z_NR<mpz_t>, FP_NR<mpfr_t>> M(A, U, U, 0);
+  MatGSO<Z_NR<mpz_t>, FP_NR<double>> M_d(A, U, U, 0);
+  M.update_gso();
+  M_d.update_gso();
+
+  FP_NR<mpfr_t> max_dist;
+  M.get_r(max_dist, 0, 0);
+  max_dist *= 0.99;
+
+  FastEvaluator<FP_NR<double>> evaluator;
+  Enumeration<Z_NR<mpz_t>, FP_NR<double>> enum_obj(M_d, evaluator);
+  FP_NR<double> fmaxdist = max_dist.get_d();
+  enum_obj.enumerate(0, d, fmaxdist, 0);
+
+  Enumerator top_enum(d, M.get_mu_matrix(), M.get_r_matrix(), max_volume, 5);
+  FastEvaluator<FP_NR<double>> sub_evaluator;
+  int sub_trees = 0;
+  while (top_enum.enum_next(max_dist))
+  {
+    Enumeration<Z_NR<mpz_t>, FP_NR<double>> sub_enum(M_d, sub_evaluator);
+    fmaxdist = max_dist.get_d();
+    sub_enum.enumerate(0, d, fmaxdist, 0, vector<FP_NR<double>>(), top_enum.get_sub_tree());
+    sub_trees++;
+  }
+
+  if (sub_trees < 2 || evaluator.empty() || sub_evaluator.empty() ||
+      evaluator.begin()->first != sub_evaluator.begin()->first)
+  {
+    std::cerr << "Enumeration of the " << sub_trees << " subtrees differs from the enumeration"
+              << " of the whole tree" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
 int main(int argc, char *argv[])
 {
   int status = 0;
   status |= test_enum<double>(30);
   status |= test_callback_enum<double>(40);
+  status |= test_affinity_enum<double>(30);
+  status |= test_estimate_enum<double>(25);
+  status |= test_top_enum(36, 3000);
 
   if (status == 0)
   {
@@ -18,6 +18,7 @@
 #include <gso_gram.h>
 #include <gso_interface.h>
 #include <householder.h>
+#include <lll.h>
 #include <nr/matrix.h>
 //#include <random>
 #include <test_utils.h>
@@ -302,11 +303,135 @@ template <class ZT, class FT> int test_int_rel(int d, int b)
   return 0;
 }
 
+/**
+   @brief Check that rotate_gram_left/right give the same lower triangle on a square Gram matrix
+   and on one created by resize_triangular.
+
+   @param d                dimension
+
+   @return zero on success
+*/
+
+int test_triangular_gram(int d)
+{
+  Matrix<Z_NR<mpz_t>> full(d, d), tri;
+  tri.resize_triangular(d);
+  for (int i = 0; i < d; i++)
+  {
+    for (int j = 0; j <= i; j++)
+    {
+      full(i, j) = rand() % 1000;
+      full(j, i) = full(i, j);
+      tri(i, j)  = full(i, j);
+    }
+  }
+
+  for (int k = 0; k < 20; k++)
+  {
+    int first = rand() % d;
+    int last  = first + rand() % (d - first);
+    if (k % 2)
+    {
+      full.rotate_gram_left(first, last, d);
+      tri.rotate_gram_left(first, last, d);
+    }
+    else
+    {
+      full.rotate_gram_right(first, last, d);
+      tri.rotate_gram_right(first, last, d);
+    }
+    for (int i = 0; i < d; i++)
+    {
+      if (tri[i].size() != i + 1)
+      {
+        cerr << "rotate_gram changed the length of row " << i << " of a triangular matrix" << endl;
+        return 1;
+      }
+      for (int j = 0; j <= i; j++)
+      {
+        if (tri(i, j) != full(i, j))
+        {
+          cerr << "rotate_gram differs on a triangular matrix at (" << i << ", " << j << ")"
+               << endl;
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+   @brief Check that get_log_det and get_current_slope, which keep prefix sums of log(r(i, i))
+   between calls, agree with a direct computation after LLL and after rows are moved.
+
+   @param d                dimension
+   @param b                bit size
+
+   @return zero on success
+*/
+
+template <class FT> int test_log_det_sums(int d, int b)
+{
+  ZZ_mat<mpz_t> A, U, UT;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  MatGSO<Z_NR<mpz_t>, FP_NR<FT>> M(A, U, UT, GSO_DEFAULT);
+  LLLReduction<Z_NR<mpz_t>, FP_NR<FT>> lll_obj(M, LLL_DEF_DELTA, LLL_DEF_ETA, LLL_DEFAULT);
+  M.update_gso();
+  M.get_log_det(0, d);
+  M.get_current_slope(0, d);
+
+  for (int k = 0; k < 4; k++)
+  {
+    if (k == 0)
+      lll_obj.lll();
+    else
+      M.move_row(d - k, k);
+    M.update_gso();
+
+    for (int start = 0; start < d; start += d / 4)
+    {
+      int end = d - start / 2;
+      FP_NR<FT> h, log_det = 0.0;
+      vector<double> x(end);
+      double x_mean = 0, v1 = 0, v2 = 0, i_mean = (end - start - 1) * 0.5 + start;
+      for (int i = start; i < end; i++)
+      {
+        M.get_r(h, i, i);
+        h.log(h);
+        log_det += h;
+        x[i] = h.get_d();
+        x_mean += x[i] / (end - start);
+      }
+      for (int i = start; i < end; i++)
+      {
+        v1 += (i - i_mean) * (x[i] - x_mean);
+        v2 += (i - i_mean) * (i - i_mean);
+      }
+      double diff  = abs((M.get_log_det(start, end) - log_det).get_d());
+      double slope = v1 / v2;
+      if (diff > 1e-6 * abs(log_det.get_d()) ||
+          abs(M.get_current_slope(start, end) - slope) > 1e-6 * abs(slope))
+      {
+        cerr << "get_log_det or get_current_slope on [" << start << ", " << end
+             << ") differs from the direct computation" << endl;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
 int main(int /*argc*/, char ** /*argv*/)
 {
 
   int status = 0;
 
+  status |= test_triangular_gram(12);
+  status |= test_log_det_sums<double>(40, 100);
+  status |= test_log_det_sums<mpfr_t>(40, 100);
+
   status |= test_filename<mpz_t, double>(TESTDATADIR "/tests/lattices/example2_in");
   status |= test_filename<mpz_t, double>(TESTDATADIR "/tests/lattices/example3_in");
   status |= test_filename<mpz_t, double>(TESTDATADIR "/tests/lattices/example_cvp_in_lattice");
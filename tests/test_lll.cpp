@@ -147,6 +147,274 @@ int test_int_rel(int d, int b, LLLMethod method, FloatType float_type = FT_DEFAU
   return test_lll<ZT>(A, method, float_type, flags, prec);
 }
 
+/**
+   @brief Check that LLL_GSO_WINDOW gives the same basis as the default on a d × (d+1) integer
+   relations matrix with bit size b: the Gram coefficients computed again are the cached ones.
+
+   @param d                dimension
+   @param b                bit size
+   @param method           LLL method to test
+   @param float_type       floating point type to test
+
+   @return zero on success
+*/
+
+int test_gso_window(int d, int b, LLLMethod method, FloatType float_type)
+{
+  ZZ_mat<mpz_t> A, B;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  B = A;
+
+  int status = lll_reduction(A, LLL_DEF_DELTA, LLL_DEF_ETA, method, float_type, 0, LLL_DEFAULT);
+  status |= lll_reduction(B, LLL_DEF_DELTA, LLL_DEF_ETA, method, float_type, 0, LLL_GSO_WINDOW);
+  if (status != RED_SUCCESS)
+  {
+    cerr << "LLL reduction with a GSO window failed with error '" << get_red_status_str(status)
+         << "'" << endl;
+    return status;
+  }
+  for (int i = 0; i < d; i++)
+  {
+    for (int j = 0; j < d + 1; j++)
+    {
+      if (A(i, j) != B(i, j))
+      {
+        cerr << "LLL reduction with a GSO window gives another basis (" << LLL_METHOD_STR[method]
+             << ")" << endl;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+   @brief Test LLL_QARY on a q-ary basis with d - k rows (e_i | h_i) and k rows q e_i of bit size
+   b: the output is LLL-reduced, and the transformation matrix maps the input to the output.
+
+   @param d                dimension
+   @param k                number of q-vectors
+   @param b                bit size of q
+
+   @return zero on success
+*/
+
+int test_qary(int d, int k, int b)
+{
+  ZZ_mat<mpz_t> A, B, C, U, UT;
+  A.resize(d, d);
+  A.gen_qary(k, b);
+  B = A;
+  C = A;
+  U.gen_identity(d);
+
+  // with a transformation matrix (mpz_t) and without (long entries)
+  int status = lll_reduction(A, U, LLL_DEF_DELTA, LLL_DEF_ETA, LM_WRAPPER, FT_DEFAULT, 0, LLL_QARY);
+  status |= lll_reduction(B, LLL_DEF_DELTA, LLL_DEF_ETA, LM_WRAPPER, FT_DEFAULT, 0, LLL_QARY);
+  if (status != RED_SUCCESS)
+  {
+    cerr << "LLL reduction of a q-ary basis failed with error '" << get_red_status_str(status)
+         << "'" << endl;
+    return status;
+  }
+
+  MatGSO<Z_NR<mpz_t>, FP_NR<mpfr_t>> MA(A, UT, UT, 0);
+  MatGSO<Z_NR<mpz_t>, FP_NR<mpfr_t>> MB(B, UT, UT, 0);
+  if (!is_lll_reduced<Z_NR<mpz_t>, FP_NR<mpfr_t>>(MA, LLL_DEF_DELTA, LLL_DEF_ETA) ||
+      !is_lll_reduced<Z_NR<mpz_t>, FP_NR<mpfr_t>>(MB, LLL_DEF_DELTA, LLL_DEF_ETA))
+  {
+    cerr << "Output of LLL reduction of a q-ary basis is not LLL reduced" << endl;
+    return 1;
+  }
+
+  Z_NR<mpz_t> x;
+  for (int i = 0; i < d; i++)
+  {
+    for (int j = 0; j < d; j++)
+    {
+      x = 0;
+      for (int l = 0; l < d; l++)
+        x.addmul(U(i, l), C(l, j));
+      if (x != A(i, j))
+      {
+        cerr << "Transformation matrix of the q-ary LLL reduction is wrong" << endl;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+   @brief Test LLL_DECOMPOSE on a block-diagonal basis made of `blocks` integer relation matrices
+   of dimension d and bit size b, with interleaved rows: the blocks must be found as orthogonal
+   components, and with one and with two threads the output must be LLL-reduced and the
+   transformation matrix must map the input to the output.
+
+   @param blocks           number of blocks
+   @param d                dimension of each block
+   @param b                bit size
+
+   @return zero on success
+*/
+
+int test_decompose(int blocks, int d, int b)
+{
+  ZZ_mat<mpz_t> A, block;
+  A.resize(blocks * d, blocks * (d + 1));
+  block.resize(d, d + 1);
+  for (int k = 0; k < blocks; k++)
+  {
+    block.gen_intrel(b);
+    for (int i = 0; i < d; i++)
+    {
+      for (int j = 0; j < d + 1; j++)
+        A(i * blocks + k, k * (d + 1) + j) = block(i, j);
+    }
+  }
+  if (orthogonal_components(A).size() != static_cast<size_t>(blocks))
+  {
+    cerr << "Wrong number of orthogonal components" << endl;
+    return 1;
+  }
+
+  int old_threads = get_threads();
+  for (int threads = 1; threads <= 2; threads++)
+  {
+    ZZ_mat<mpz_t> B = A, U, UT;
+    U.gen_identity(blocks * d);
+    set_threads(threads);
+    int status =
+        lll_reduction(B, U, LLL_DEF_DELTA, LLL_DEF_ETA, LM_WRAPPER, FT_DEFAULT, 0, LLL_DECOMPOSE);
+    set_threads(old_threads);
+    if (status != RED_SUCCESS)
+    {
+      cerr << "LLL reduction of the components failed with error '" << get_red_status_str(status)
+           << "'" << endl;
+      return status;
+    }
+
+    MatGSO<Z_NR<mpz_t>, FP_NR<mpfr_t>> M(B, UT, UT, 0);
+    if (!is_lll_reduced<Z_NR<mpz_t>, FP_NR<mpfr_t>>(M, LLL_DEF_DELTA, LLL_DEF_ETA))
+    {
+      cerr << "Output of LLL reduction of the components is not LLL reduced" << endl;
+      return 1;
+    }
+
+    Z_NR<mpz_t> x;
+    for (int i = 0; i < A.get_rows(); i++)
+    {
+      for (int j = 0; j < A.get_cols(); j++)
+      {
+        x = 0;
+        for (int l = 0; l < A.get_rows(); l++)
+          x.addmul(U(i, l), A(l, j));
+        if (x != B(i, j))
+        {
+          cerr << "Transformation matrix of the LLL reduction of the components is wrong" << endl;
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+   @brief Check lll_predict_prec on a corpus where the outcome of fast LLL in double precision
+   (delta = 0.99, eta = 0.51) was measured: double succeeds on knapsacks with few bits per
+   dimension and on random bases, whose Gram-Schmidt norms span a short range, but not on a
+   200-dimensional knapsack with 2000 bits.
+
+   @return zero on success
+*/
+
+int test_predict_prec()
+{
+  struct
+  {
+    char type;
+    int d, b;
+    bool double_ok;
+  } corpus[] = {{'r', 160, 1000, true}, {'r', 200, 2000, false}, {'r', 300, 80, true},
+                {'u', 180, 20, true},   {'q', 80, 10, true}};
+
+  for (auto &c : corpus)
+  {
+    ZZ_mat<mpz_t> A;
+    if (c.type == 'r')
+    {
+      A.resize(c.d, c.d + 1);
+      A.gen_intrel(c.b);
+    }
+    else if (c.type == 'u')
+    {
+      A.resize(c.d, c.d);
+      A.gen_uniform(c.b);
+    }
+    else
+    {
+      A.resize(c.d, c.d);
+      A.gen_qary_prime(c.d / 2, c.b);
+    }
+    int prec     = lll_predict_prec(A);
+    int max_prec = l2_min_prec(c.d, LLL_DEF_DELTA, LLL_DEF_ETA, LLL_DEF_EPSILON);
+    if (prec < PREC_DOUBLE || prec > max_prec || (prec <= PREC_DOUBLE) != c.double_ok)
+    {
+      cerr << "Wrong predicted precision " << prec << " for lattice " << c.type << " d=" << c.d
+           << " b=" << c.b << endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+   @brief Test the LLL counters on a d × (d+1) integer relations matrix with bit size b.
+
+   @param d                dimension
+   @param b                bit size
+   @param method           LLL method to test
+   @param float_type       floating point type to test
+
+   @return zero on success
+*/
+
+int test_stats(int d, int b, LLLMethod method, FloatType float_type = FT_DEFAULT)
+{
+  ZZ_mat<mpz_t> A, B, U;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  B = A;
+
+  // counters of a single reduction object
+  MatGSO<Z_NR<mpz_t>, FP_NR<double>> m(B, U, U, GSO_ROW_EXPO | GSO_OP_FORCE_LONG);
+  LLLReduction<Z_NR<mpz_t>, FP_NR<double>> lll_obj(m, LLL_DEF_DELTA, LLL_DEF_ETA, LLL_DEFAULT);
+  lll_obj.lll();
+  LLLStats s = lll_obj.get_stats();
+  int status = 0;
+  status |= s.lll_calls != 1 || s.swaps != static_cast<uint64_t>(lll_obj.n_swaps);
+  status |= s.swaps == 0 || s.size_reduction_iterations == 0 || s.gso.gso_row_updates == 0;
+  status |= s.gso.row_addmul_we == 0 || s.babai_restarts > s.size_reduction_iterations;
+  status |= s.gso.row_add + s.gso.row_addmul_si + s.gso.row_addmul_2exp < s.gso.row_addmul_we;
+  status |= s.precision_escalations != 0 || s.total_time() != 0.0;
+
+  // counters returned by lll_reduction
+  LLLStats t;
+  status |= lll_reduction(A, LLL_DEF_DELTA, LLL_DEF_ETA, method, float_type, 0, LLL_DEFAULT, &t);
+  status |= t.lll_calls == 0 || t.swaps == 0 || t.size_reduction_iterations == 0;
+  status |= t.precision_escalations >= t.lll_calls || t.total_time() <= 0.0;
+  if (method == LM_FAST)
+    status |= t.heuristic_time != 0.0 || t.proved_time != 0.0;
+
+  if (status)
+  {
+    cerr << "LLL counters are inconsistent (" << LLL_METHOD_STR[method] << ")" << endl;
+  }
+  return status;
+}
+
 int main(int /*argc*/, char ** /*argv*/)
 {
 
@@ -170,6 +438,26 @@ int main(int /*argc*/, char ** /*argv*/)
   status |= test_filename<mpz_t>(TESTDATADIR "/tests/lattices/example_in", LM_HEURISTIC, FT_DEFAULT,
                                  LLL_DEFAULT | LLL_EARLY_RED);
 
+  // more rows than GSO_DEF_WINDOW, so that rows of the Gram matrix are left out
+  status |= test_int_rel<mpz_t>(100, 1000, LM_WRAPPER, FT_DEFAULT, LLL_GSO_WINDOW);
+  status |= test_gso_window(100, 1000, LM_FAST, FT_DOUBLE);
+  status |= test_gso_window(100, 1000, LM_HEURISTIC, FT_DPE);
+
+  status |= test_stats(40, 400, LM_WRAPPER);
+  status |= test_stats(40, 400, LM_FAST, FT_DOUBLE);
+
+  status |= test_qary(60, 30, 20);
+  status |= test_qary(40, 10, 60);
+  status |= test_int_rel<mpz_t>(50, 1000, LM_WRAPPER, FT_DEFAULT, LLL_QARY);
+
+  status |= test_decompose(3, 30, 300);
+  status |= test_int_rel<mpz_t>(40, 1000, LM_FAST, FT_DOUBLE, LLL_DECOMPOSE);
+
+  status |= test_predict_prec();
+  status |= test_int_rel<mpz_t>(50, 1000, LM_WRAPPER, FT_DEFAULT, LLL_PREDICT_PREC);
+  status |= test_int_rel<mpz_t>(50, 1000, LM_FAST, FT_DEFAULT, LLL_PREDICT_PREC);
+  status |= test_int_rel<mpz_t>(30, 2000, LM_HEURISTIC, FT_DEFAULT, LLL_PREDICT_PREC);
+
   if (status == 0)
   {
     cerr << "All tests passed." << endl;
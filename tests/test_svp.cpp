@@ -312,6 +312,50 @@ int test_filename(const char *input_filename, const char *output_filename,
   return 1;
 }
 
+/**
+   @brief Test that the bound of ErrorBoundedEvaluator::get_max_error_aux computed in double is an
+   upper bound on the one computed in FP_NR<mpfr_t> and is close to it.
+
+   @param d              dimension
+   @param b              bit size
+   @return zero on success
+*/
+
+int test_error_bound(int d, int b)
+{
+  ZZ_mat<mpz_t> A, U;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  lll_reduction(A);
+  MatGSO<Z_NR<mpz_t>, FP_NR<mpfr_t>> gso(A, U, U, GSO_INT_GRAM);
+  gso.update_gso();
+  FastErrorBoundedEvaluator evaluator(d, gso.get_mu_matrix(), gso.get_r_matrix());
+  evaluator.init_delta_def(FP_NR<mpfr_t>::get_prec(), 1.2, true);
+
+  FP_NR<mpfr_t> max_dist, fast_de, mpfr_de, rel_diff;
+  gso.get_r(max_dist, 0, 0);
+  for (int k = 0; k < 4; k++)
+  {
+    bool exact = k % 2;
+    if (!evaluator.get_max_error_aux(max_dist, exact, fast_de) ||
+        !evaluator.get_max_error_aux(max_dist, exact, mpfr_de, false))
+    {
+      cerr << "The error of the enumeration cannot be bounded" << endl;
+      return 1;
+    }
+    rel_diff.sub(fast_de, mpfr_de);
+    rel_diff.div(rel_diff, mpfr_de);
+    if (fast_de < mpfr_de || rel_diff > 1e-6)
+    {
+      cerr << "The error bound in double " << fast_de << " differs from the one in mpfr "
+           << mpfr_de << endl;
+      return 1;
+    }
+    max_dist.mul_2si(max_dist, 1);
+  }
+  return 0;
+}
+
 /**
    @brief Run SVP tests.
 
@@ -330,6 +374,7 @@ int main()
                                  TESTDATADIR "/tests/lattices/example_dsvp_out", DSVP_REDUCE);
 
   status |= test_rank_defect();
+  status |= test_error_bound(40, 40);
 
   if (status == 0)
   {
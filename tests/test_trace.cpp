@@ -0,0 +1,104 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include <cstdio>
+#include <fplll.h>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+using namespace fplll;
+
+/**
+   @brief Record the zones of an LLL, a BKZ and an SVP call and check that they are written to
+   `filename`. Without tracing support, check that nothing is recorded.
+
+   @param filename         output file
+   @param d                dimension
+   @param b                bit size
+   @param block_size       block size
+
+   @return zero on success.
+*/
+
+int test_trace(const char *filename, int d, int b, int block_size)
+{
+#ifdef FPLLL_WITH_TRACING
+  ZZ_mat<mpz_t> A;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+
+  auto extenum = get_external_enumerator();
+  set_external_enumerator(nullptr);
+  trace_clear();
+  int status = !trace_start();
+  status |= lll_reduction(A);
+  status |= bkz_reduction(A, block_size, BKZ_DEFAULT, FT_DOUBLE);
+  vector<Z_NR<mpz_t>> sol_coord;
+  status |= shortest_vector(A, sol_coord, SVPM_FAST);
+  trace_stop();
+  set_external_enumerator(extenum);
+
+  status |= !trace_write(filename);
+  ifstream is(filename);
+  stringstream ss;
+  ss << is.rdbuf();
+  string trace = ss.str();
+  remove(filename);
+
+  const char *zones[] = {"traceEvents", "Wrapper::lll", "LLLReduction::lll",
+                         "BKZReduction::svp_preprocessing", "BKZReduction::svp_reduction",
+                         "EnumerationDyn::enumerate"};
+  for (const char *zone : zones)
+  {
+    if (trace.find(zone) == string::npos)
+    {
+      cerr << "Zone " << zone << " missing in the trace" << endl;
+      status = 1;
+    }
+  }
+  return status;
+#else
+  if (trace_start() || trace_write(filename))
+  {
+    cerr << "Tracing enabled without tracing support" << endl;
+    return 1;
+  }
+  (void)d;
+  (void)b;
+  (void)block_size;
+  return 0;
+#endif
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+
+  int status = 0;
+
+  status |= test_trace("test_trace.json", 40, 400, 10);
+
+  if (status == 0)
+  {
+    cerr << "All tests passed." << endl;
+    return 0;
+  }
+  else
+  {
+    return -1;
+  }
+
+  return 0;
+}
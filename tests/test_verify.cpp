@@ -0,0 +1,136 @@
+/* Copyright (C) 2026 The FPLLL authors.
+
+   This file is part of fplll. fplll is free software: you
+   can redistribute it and/or modify it under the terms of the GNU Lesser
+   General Public License as published by the Free Software Foundation,
+   either version 2.1 of the License, or (at your option) any later version.
+
+   fplll is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with fplll. If not, see <http://www.gnu.org/licenses/>. */
+
+#include <cstring>
+#include <fplll.h>
+
+using namespace std;
+using namespace fplll;
+
+/**
+   @brief Test that an LLL-reduced basis is certified reduced in double, with one and with two
+   threads, and that the input basis is certified not reduced.
+
+   @param d                dimension
+   @param b                bit size
+
+   @return zero on success.
+*/
+
+int test_verify_lll(int d, int b)
+{
+  ZZ_mat<mpz_t> A;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+
+  LLLVerifyResult res = verify_lll_reduced(A);
+  if (res.status != LLL_VERIFY_NOT_REDUCED || res.failed_rows.empty())
+  {
+    cerr << "Input basis not certified as not LLL-reduced" << endl;
+    return 1;
+  }
+
+  lll_reduction(A);
+  int old_threads = get_threads();
+  for (int threads = 1; threads <= 2; threads++)
+  {
+    set_threads(threads);
+    res = verify_lll_reduced(A);
+    if (res.status != LLL_VERIFY_REDUCED || res.precision != 53 || !res.escalated_rows.empty())
+    {
+      cerr << "LLL-reduced basis not certified in double with " << threads << " threads" << endl;
+      set_threads(old_threads);
+      return 1;
+    }
+  }
+  set_threads(old_threads);
+  return 0;
+}
+
+/**
+   @brief Test that an HLLL-reduced basis is certified HLLL-reduced.
+
+   @param d                dimension
+   @param b                bit size
+
+   @return zero on success.
+*/
+
+int test_verify_hlll(int d, int b)
+{
+  ZZ_mat<mpz_t> A;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  hlll_reduction(A);
+
+  LLLVerifyResult res = verify_hlll_reduced(A);
+  if (res.status != LLL_VERIFY_REDUCED)
+  {
+    cerr << "HLLL-reduced basis not certified" << endl;
+    return 1;
+  }
+  return 0;
+}
+
+/**
+   @brief Test that the rows which overflow in double are checked again with mpfr.
+
+   @param d                dimension
+   @param b                bit size
+   @param scale            the reduced basis is multiplied by 2^scale
+
+   @return zero on success.
+*/
+
+int test_verify_escalation(int d, int b, int scale)
+{
+  ZZ_mat<mpz_t> A;
+  A.resize(d, d + 1);
+  A.gen_intrel(b);
+  lll_reduction(A);
+  for (int i = 0; i < A.get_rows(); i++)
+    for (int j = 0; j < A.get_cols(); j++)
+      A[i][j].mul_2si(A[i][j], scale);
+
+  LLLVerifyResult res = verify_lll_reduced(A);
+  if (res.status != LLL_VERIFY_REDUCED || res.escalated_rows.empty() || res.precision <= 53)
+  {
+    cerr << "Scaled basis not certified after escalation" << endl;
+    return 1;
+  }
+  return 0;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+
+  int status = 0;
+
+  status |= test_verify_lll(30, 100);
+  status |= test_verify_hlll(30, 100);
+  status |= test_verify_escalation(20, 50, 600);
+
+  if (status == 0)
+  {
+    cerr << "All tests passed." << endl;
+    return 0;
+  }
+  else
+  {
+    return -1;
+  }
+
+  return 0;
+}